@@ -36,6 +36,7 @@
 #define calculatorfunction_h
 
 #include "function.h"
+#include "parser.h"
 
 ///@name Input fields for CalculatorFunction
 //@{
@@ -49,7 +50,7 @@
 namespace oofem {
 /**
  * Class representing user defined load time function. User input is function expression.
- * Uses Parser class to parse given expression. Slow but useful.
+ * The expressions are compiled once (see CompiledExpression) and evaluated without reparsing.
  * Load time function typically belongs to domain and is
  * attribute of one or more loads. Generally load time function is real function of time (@f$ y=f(t) @f$).
  */
@@ -62,6 +63,8 @@ private:
     std :: string dfdtExpression;
     /// Expression for second time derivative.
     std :: string d2fdt2Expression;
+    /// Compiled expressions, with time "t" as positional argument.
+    CompiledExpression fCode, dfdtCode, d2fdt2Code;
 
 public:
     /**
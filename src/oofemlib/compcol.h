@@ -112,6 +112,7 @@ public:
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &s) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
     bool canBeFactorized() const override { return false; }
     void zero() override;
     double &at(int i, int j) override;
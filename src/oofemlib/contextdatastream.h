@@ -0,0 +1,185 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef contextdatastream_h
+#define contextdatastream_h
+
+#include "datastream.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <memory>
+
+namespace oofem {
+/**
+ * Sectioned context file stream.
+ * Data are written in named sections (engineering model header, each domain, blocks of elements,
+ * numerical method), see DataStream::beginSection. Each section is stored independently, optionally
+ * compressed (zlib, when compiled with __ZLIB_MODULE), and the file is terminated by an index of sections
+ * (their offsets and sizes are known only once the data are written).
+ *
+ * The stream either writes directly to file, buffering (and compressing) only one chunk of data at a time,
+ * or collects the complete snapshot in memory; the latter is then written by writeToFile, which can be called
+ * from a different thread than the one producing the data, so the analysis can proceed while the file is
+ * compressed and flushed.
+ *
+ * Layout: magic, format version, section data, index (name, offset, stored size, raw size, compression flag),
+ * index offset, end magic.
+ *
+ * When reading, the sections are presented as one continuous stream in the order in which they were written,
+ * so the usual restoreContext methods are used unchanged. Section data are decompressed in chunks and released
+ * once read, so only one section is held in memory.
+ */
+class OOFEM_EXPORT ContextDataStream : public DataStream
+{
+public:
+    /// Section record.
+    struct Section {
+        std :: string name;
+        /// Offset of stored data in file.
+        std :: uint64_t offset = 0;
+        /// Size of stored (possibly compressed) data.
+        std :: uint64_t storedSize = 0;
+        /// Size of uncompressed data.
+        std :: uint64_t rawSize = 0;
+        /// Nonzero if section data are compressed.
+        int compressed = 0;
+        /// Uncompressed data (snapshot in memory, pending chunk when writing directly, or loaded lazily when reading).
+        std :: vector< char >data;
+        /// Flag indicating that data are loaded.
+        bool loaded = false;
+    };
+
+private:
+    /// Sections of the stream.
+    std :: vector< Section >sections;
+    /// Currently read/written section.
+    std :: size_t current;
+    /// Read position within current section.
+    std :: size_t position;
+    /// Compression flag (writing).
+    bool compress;
+    /// File being read, or written directly.
+    FILE *file;
+    std :: string filename;
+    /// Flag indicating that data are written directly to file.
+    bool direct;
+    /// Offset of the end of data written directly to file.
+    std :: uint64_t offset;
+    /// Flag indicating a failure of direct output.
+    bool failed;
+    /// Compression state (z_stream) of section being written directly.
+    void *zstream;
+
+public:
+    /// Creates empty stream for writing into memory. If compress is true, sections are compressed when written to file.
+    ContextDataStream(bool compress);
+    /**
+     * Creates stream writing directly to given file, the data are written (and compressed) in chunks as they are produced.
+     * The file is completed by finish.
+     * @exception FileDataStream::CantOpen if file can not be opened.
+     */
+    ContextDataStream(const std :: string &filename, bool compress);
+    /**
+     * Opens given file for reading; reads the index only, section data are loaded on demand.
+     * @exception FileDataStream::CantOpen if file can not be opened or is not a sectioned context file.
+     */
+    ContextDataStream(std :: string filename);
+    ContextDataStream(const char *filename) : ContextDataStream(std :: string(filename) ) { }
+    virtual ~ContextDataStream();
+
+    /// Returns true if given file starts with the signature of sectioned context file.
+    static bool isContextFile(const std :: string &filename);
+    /**
+     * Opens context file for reading, either in sectioned format or as plain FileDataStream.
+     * @exception FileDataStream::CantOpen if file can not be opened.
+     */
+    static std :: unique_ptr< DataStream >openFile(const std :: string &filename);
+
+    /**
+     * Writes the sections to given file (compressing them if requested).
+     * Data of each section are released once written, so the stream can be written only once.
+     * Only the stream itself is accessed, so it is safe to call it from a background thread.
+     * @return Nonzero if successful.
+     */
+    int writeToFile(const std :: string &filename);
+    /**
+     * Completes the file written directly (flushes the last section, writes the index) and closes it.
+     * @return Nonzero if all data were successfully written.
+     */
+    int finish();
+
+    void beginSection(const std :: string &name) override;
+
+    using DataStream :: read;
+    using DataStream :: write;
+
+    int read(int *data, std :: size_t count) override { return this->readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, std :: size_t count) override { return this->readBytes(data, sizeof( unsigned long ) * count); }
+#ifdef _MSC_VER
+    int read(std :: size_t *data, std :: size_t count) override { return this->readBytes(data, sizeof( std :: size_t ) * count); }
+#endif
+    int read(long *data, std :: size_t count) override { return this->readBytes(data, sizeof( long ) * count); }
+    int read(double *data, std :: size_t count) override { return this->readBytes(data, sizeof( double ) * count); }
+    int read(char *data, std :: size_t count) override { return this->readBytes(data, count); }
+    int read(bool &data) override { return this->readBytes(& data, sizeof( bool ) ); }
+
+    int write(const int *data, std :: size_t count) override { return this->writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, std :: size_t count) override { return this->writeBytes(data, sizeof( unsigned long ) * count); }
+#ifdef _MSC_VER
+    int write(const std :: size_t *data, std :: size_t count) override { return this->writeBytes(data, sizeof( std :: size_t ) * count); }
+#endif
+    int write(const long *data, std :: size_t count) override { return this->writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, std :: size_t count) override { return this->writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, std :: size_t count) override { return this->writeBytes(data, count); }
+    int write(bool data) override { return this->writeBytes(& data, sizeof( bool ) ); }
+
+    int givePackSizeOfInt(std :: size_t count) override { return (int) ( sizeof( int ) * count ); }
+    int givePackSizeOfDouble(std :: size_t count) override { return (int) ( sizeof( double ) * count ); }
+    int givePackSizeOfChar(std :: size_t count) override { return (int) ( sizeof( char ) * count ); }
+    int givePackSizeOfBool(std :: size_t count) override { return (int) ( sizeof( bool ) * count ); }
+    int givePackSizeOfLong(std :: size_t count) override { return (int) ( sizeof( long ) * count ); }
+    int givePackSizeOfSizet(std :: size_t count) override { return (int) ( sizeof( std :: size_t ) * count ); }
+
+protected:
+    int readBytes(void *dest, std :: size_t n);
+    int writeBytes(const void *src, std :: size_t n);
+    /// Loads (and uncompresses) data of given section from file.
+    bool loadSection(Section &s);
+    /// Writes (compressing if requested) pending data of current section to file; on last call, the section is completed.
+    void flushSection(bool last);
+};
+} // end namespace oofem
+#endif // contextdatastream_h
@@ -38,6 +38,9 @@
 #include "oofemenv.h"
 #include "inputrecord.h"
 
+#include <memory>
+#include <vector>
+
 namespace oofem {
 /**
  * Class representing the abstraction for input data source.
@@ -54,6 +57,8 @@ protected:
     std :: string outputFileName;
     /// Description line (second line in OOFEM input files).
     std :: string description;
+    /// Storage for records returned by default implementation of giveInputRecords.
+    std :: vector< std :: unique_ptr< InputRecord > >recordBlock;
 
 public:
     /// Determines the type of input record.
@@ -77,6 +82,25 @@ public:
      */
     virtual InputRecord &giveInputRecord(InputRecordType irType, int recordId) = 0;
 
+    /**
+     * Returns a block of consecutive input records of given type.
+     * Contrary to giveInputRecord, the returned records remain valid until the next call
+     * of this method (or finish), so they can be processed concurrently.
+     * The default implementation stores copies of records obtained from giveInputRecord.
+     * @param answer Array of records, with record_id going from 1 to count.
+     * @param irType Determines type of records to be returned.
+     * @param count Number of records.
+     */
+    virtual void giveInputRecords(std :: vector< InputRecord * > &answer, InputRecordType irType, int count)
+    {
+        recordBlock.clear();
+        answer.clear();
+        for ( int i = 1; i <= count; i++ ) {
+            recordBlock.push_back( this->giveInputRecord(irType, i).clone() );
+            answer.push_back( recordBlock.back().get() );
+        }
+    }
+
     /**
      * Peak in advance into the record list.
      * @return True if next keyword is a set.
@@ -91,9 +115,9 @@ public:
     /// Gives the reference file name (e.g. file name)
     virtual std :: string giveReferenceName() const = 0;
     /// Gives the output file name
-    std :: string giveOutputFileName() { return this->outputFileName; }
+    std :: string giveOutputFileName() const { return this->outputFileName; }
     /// Gives the problem description
-    std :: string giveDescription() { return this->description; }
+    std :: string giveDescription() const { return this->description; }
 };
 } // end namespace oofem
 #endif // datareader_h
@@ -135,6 +135,13 @@ public:
     virtual int givePackSizeOfLong(std::size_t count) = 0;
     virtual int givePackSizeOfSizet(std::size_t count) = 0;
     //@}
+
+    /**
+     * Starts new named section of the stream. Subsequent data are written into this section.
+     * Streams without the notion of sections ignore it (default); when reading, sections are
+     * consumed transparently in the order they were written.
+     */
+    virtual void beginSection(const std :: string &name) { }
 };
 
 
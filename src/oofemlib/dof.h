@@ -390,15 +390,15 @@ public:
     virtual void setEquationNumber(int equationNumber) { }
 
     /**
-     * Sets the dictionary of unknowns for receiver.
-     * @param unknowns New dictionary of unknowns.
+     * Checks whether receiver's unknowns dictionary contains given key.
+     * @param key Hash index, see EngngModel::giveUnknownDictHashIndx.
      */
-    virtual void setUnknowns(Dictionary *unknowns) { }
+    virtual bool hasUnknownsDictionaryEntry(int key) { return false; }
     /**
-     * Receives the dictionary of unknowns in receiver.
-     * @return Dictionary of unknowns for DOF.
+     * Access dictionary value by key, if not present zero is returned.
+     * @param key Hash index, see EngngModel::giveUnknownDictHashIndx.
      */
-    virtual Dictionary *giveUnknowns() { return NULL; }
+    virtual double giveUnknownsDictionaryEntry(int key) { return 0; }
 
     /**
      * Gives number for equation, negative for prescribed equations.
@@ -0,0 +1,129 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef dofunknownstore_h
+#define dofunknownstore_h
+
+#include "oofemenv.h"
+
+#include <vector>
+
+namespace oofem {
+class DataStream;
+
+/**
+ * Flat storage of dof unknowns for engineering models that keep their solution history in dofs
+ * (see EngngModel::requiresUnknownsDictionaryUpdate). It replaces a linked list Dictionary per dof.
+ *
+ * Each dof owns one record, allocated on first write. A record holds one value per unknown key,
+ * where keys are the hash indices given by EngngModel::giveUnknownDictHashIndx, which encode value mode
+ * and time level. Keys are mapped to slots in the order they first appear, so all records share the same
+ * layout and all values live in one contiguous array, stored record by record.
+ * Released records are reused by subsequently allocated dofs.
+ */
+class OOFEM_EXPORT DofUnknownStore
+{
+protected:
+    /// Number of slots per record.
+    int nslots;
+    /// Key -> slot, -1 if key has not been used yet.
+    std :: vector< int >keySlot;
+    /// Values, record after record.
+    std :: vector< double >values;
+    /// Flags marking the slots which have been set.
+    std :: vector< char >present;
+    /// Number of allocated records (including released ones).
+    int nrecords;
+    /// Released records available for reuse.
+    std :: vector< int >freeRecords;
+
+public:
+    /// Constructor, creates empty store.
+    DofUnknownStore() : nslots(0), nrecords(0) { }
+
+    /// Allocates new empty record and returns its index.
+    int allocate();
+    /// Releases given record.
+    void release(int record);
+    /// Removes all records and keys.
+    void clear();
+    /// Returns the number of records in use.
+    int giveNumberOfRecords() const { return nrecords - ( int ) freeRecords.size(); }
+
+    /// Checks whether the record contains value with given key.
+    bool includes(int record, int key) const
+    {
+        int slot = key >= 0 && key < ( int ) keySlot.size() ? keySlot [ key ] : -1;
+        return slot >= 0 && present [ record * nslots + slot ];
+    }
+    /**
+     * Returns the value with given key; if the record does not contain it, it is created with value 0.
+     * May reorganize the storage, so it must not be called concurrently.
+     */
+    double &at(int record, int key)
+    {
+        int slot = key >= 0 && key < ( int ) keySlot.size() ? keySlot [ key ] : -1;
+        if ( slot < 0 ) {
+            slot = this->giveNewSlot(key);
+        }
+        int i = record * nslots + slot;
+        if ( !present [ i ] ) {
+            present [ i ] = 1;
+            values [ i ] = 0.;
+        }
+        return values [ i ];
+    }
+    /// Returns the value with given key, zero if the record does not contain it. Does not modify the receiver.
+    double giveValue(int record, int key) const
+    {
+        return this->includes(record, key) ? values [ record * nslots + keySlot [ key ] ] : 0.;
+    }
+    /**
+     * Saves the record contents, in the same format as Dictionary::saveContext.
+     * Negative record stands for an empty one.
+     * @exception throws an ContextIOERR exception if error encountered
+     */
+    void saveContext(int record, DataStream &stream) const;
+    /**
+     * Restores the record contents, in the same format as Dictionary::restoreContext.
+     * @exception throws an ContextIOERR exception if error encountered
+     */
+    void restoreContext(int record, DataStream &stream);
+
+protected:
+    /// Assigns a slot to a new key, enlarging all records.
+    int giveNewSlot(int key);
+};
+} // end namespace oofem
+#endif // dofunknownstore_h
@@ -41,6 +41,8 @@
 #include "intarray.h"
 #include "error.h"
 #include "bctracker.h"
+#include "dofunknownstore.h"
+#include "elementlocationcache.h"
 #ifdef __MPI_PARALLEL_MODE
  #include "entityrenumberingscheme.h"
 #endif
@@ -88,6 +90,7 @@ class ConnectivityTable;
 class ErrorEstimator;
 class SpatialLocalizer;
 class NodalRecoveryModel;
+class NodalRecoveryCache;
 class NonlocalBarrier;
 class DomainTransactionManager;
 class XfemManager;
@@ -114,6 +117,10 @@ class ContactManager;
  */
 class OOFEM_EXPORT Domain
 {
+private:
+    /// Unknowns of dofs in the domain (declared first, so that it outlives the dofs referencing it).
+    DofUnknownStore dofUnknownStore;
+
     public:
     /// Element list.
     std :: vector< std :: unique_ptr< Element > > elementList;
@@ -173,6 +180,8 @@ private:
     bool axisymm;
     /// nodal recovery object associated to receiver.
     std :: unique_ptr< NodalRecoveryModel > smoother; ///@todo I don't see why this has to be stored, and there is only one? /Mikael
+    /// Nodal values recovered by the recovery models of the domain.
+    std :: unique_ptr< NodalRecoveryCache > nodalRecoveryCache;
 
     std :: string mDomainType;
     /**
@@ -186,6 +195,8 @@ private:
      * because in case of multiple domains stateCounter should be kept independently for each domain.
      */
     StateCounterType nonlocalUpdateStateCounter;
+    /// Equation numbering state counter, incremented whenever equations of the domain are renumbered.
+    StateCounterType equationNumberingStateCounter;
     /// XFEM Manager
     std :: unique_ptr< XfemManager > xfemManager;
 
@@ -197,6 +208,8 @@ private:
 
     /// BC tracker (keeps track of BCs applied wia sets to components)
     BCTracker bcTracker;
+    /// Cached element location arrays.
+    ElementLocationCache elementLocationCache;
     
     /**
      * Map from an element's global number (label) to its place
@@ -523,6 +536,10 @@ public:
     bool hasFractureManager();
 
     BCTracker *giveBCTracker();
+    /// Returns the cache of element location arrays.
+    ElementLocationCache *giveElementLocationCache() { return & this->elementLocationCache; }
+    /// Returns the store of dof unknowns of engineering models using unknowns dictionaries.
+    DofUnknownStore *giveDofUnknownStore() { return & this->dofUnknownStore; }
     
     /**
      * Sets receiver's associated topology description.
@@ -641,6 +658,8 @@ public:
      * Creates the default, if no one associated.
      */
     NodalRecoveryModel *giveSmoother();
+    /// Returns the store of recovered nodal values shared by all nodal recovery models of receiver.
+    NodalRecoveryCache *giveNodalRecoveryCache();
     /**
      * Returns receiver's associated topology description.
      */
@@ -709,6 +728,10 @@ public:
     StateCounterType giveNonlocalUpdateStateCounter() { return this->nonlocalUpdateStateCounter; }
     /// sets the value of nonlocalUpdateStateCounter
     void setNonlocalUpdateStateCounter(StateCounterType val) { this->nonlocalUpdateStateCounter = val; }
+    /// Returns the value of equationNumberingStateCounter
+    StateCounterType giveEquationNumberingStateCounter() const { return this->equationNumberingStateCounter; }
+    /// Marks the equation numbers of the domain as changed, invalidating the cached location arrays.
+    void incrementEquationNumberingStateCounter() { this->equationNumberingStateCounter++; }
 
     void resolveDomainDofsDefaults(const char *);
 
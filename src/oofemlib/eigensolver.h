@@ -43,10 +43,16 @@
 #include <iostream>
 #include "sparsegeneigenvalsystemnm.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
+#include <Eigen/Sparse>
+
+#include <memory>
+#include <vector>
 
 namespace oofem {
 class Domain;
 class EngngModel;
+class EigenSolverMatrix;
 
 /**
  * This class implements the class NumericalMethod instance that uses
@@ -62,19 +68,53 @@ class EngngModel;
  *   solveYourselfAt.
  * - returning results (eigen values and associated eigen vectors).
  *
- *
+ * By default, the largest eigenvalues of the inverted problem are computed by Spectra. When an eigenvalue range or
+ * a mass participation target is set, the shift-invert Lanczos method is used instead. It works with the M-inner
+ * product on @f$ (K - \sigma M)^{-1} M @f$, accepts converged Ritz pairs above the shift and moves the shift
+ * up the spectrum until enough modes (or enough effective modal mass) are found. Converged modes are deflated,
+ * the inertia of the shifted factorization is used to detect missed eigenvalues. The symbolic analysis of the
+ * shifted matrix is shared by all shifts (and by subsequent calls, as long as the pattern is unchanged).
  */
  // not exportable due to conflicts with eigen OOFEM_EXPORT
 class  EigenSolver : public SparseGeneralEigenValueSystemNM
 {
 private:
+    typedef Eigen::SimplicialLDLT< Eigen::SparseMatrix< double > > Factorization;
+
     int nitem;
+    /// Lower and upper bounds of required eigenvalues (shift-invert mode).
+    double rangeLo, rangeHi;
+    /// Flag indicating shift-invert mode.
+    bool shiftInvert;
+    /// Influence vectors for mass participation criterion.
+    FloatMatrix influence;
+    /// Required ratio of effective modal mass, zero if not used.
+    double massRatio;
+
+    /// Factorization of the shifted matrix.
+    std :: unique_ptr< Factorization > factorization;
+    /// Last shifted matrix.
+    Eigen::SparseMatrix< double > shiftedMatrix;
+    /// Shift the factorization has been computed for (NaN if invalid).
+    double factorizedShift;
+    /// Pattern of the symbolic analysis.
+    std :: vector< int > patternColumns, patternRows;
+
+    /**
+     * Factorizes @f$ A - \sigma B @f$, reusing the symbolic analysis if the pattern has not changed.
+     * @return Number of negative pivots (eigenvalues below the shift), -1 if factorization failed.
+     */
+    int factorizeShifted(EigenSolverMatrix &A, EigenSolverMatrix &B, double sigma);
+    /// Shift-invert Lanczos solution, see class description.
+    ConvergedReason solveShiftInvert(EigenSolverMatrix &A, EigenSolverMatrix &B, FloatArray &x, FloatMatrix &v, double rtol, int nroot);
 
 public:
     EigenSolver(Domain * d, EngngModel * m);
     virtual ~EigenSolver();
 
     virtual ConvergedReason solve(SparseMtrx &A, SparseMtrx &B, FloatArray &x, FloatMatrix &v, double rtol, int nroot);
+    virtual void setEigenValueRange(double lo, double hi);
+    virtual void setMassParticipationTarget(const FloatMatrix &influence, double ratio);
     virtual const char *giveClassName() const { return "EigenSolver"; }
 };
 } // end namespace oofem
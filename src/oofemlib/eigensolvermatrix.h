@@ -57,10 +57,11 @@ namespace oofem {
 protected:
 
 	std::unique_ptr<Eigen::SparseMatrix<double>> eigenMatrix;
-	std::vector<Eigen::Triplet<double>> tripletList;
+	/// Assembled entries outside of the sparsity pattern, one list per thread, so that concurrent assembly needs no locking.
+	std::vector<std::vector<Eigen::Triplet<double>>> tripletLists;
 	
 public:
-	EigenSolverMatrix() {};  // default
+	EigenSolverMatrix() : EigenSolverMatrix(0) {};  // default
     /**
      * Constructor. Before any operation an internal profile must be built.
      * @param t Storage type
@@ -83,6 +84,7 @@ public:
     virtual int assemble(const IntArray &loc, const FloatMatrix &mat);
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
 	virtual int assembleEnd();
+	virtual bool supportsConcurrentAssembly() const { return true; }
     virtual bool canBeFactorized() const { return true; }
     virtual void zero();
     virtual double &at(int i, int j);
@@ -103,7 +105,12 @@ public:
 	virtual void writeToFile(const char *fname) const;
 
 protected:
+	/// Adds the entries outside of the pattern (collected as triplets) to the matrix.
 	void applyTriplets();
+	/// Adds value to 0-based entry (i, j), in place if the entry is in the pattern.
+	void addToEntry(int i, int j, double value);
+	/// Returns the triplet list of the calling thread.
+	std::vector<Eigen::Triplet<double>> &giveTripletList();
 };
 
 // #define SparseMat Eigen::SparseMatrix<double, 0, int>
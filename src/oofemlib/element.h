@@ -212,9 +212,14 @@ public:
     //@{
     /**
      * Returns the location array (array of code numbers) of receiver for given numbering scheme.
-     * Results are cached at receiver for default scheme in locationArray attribute.
+     * Results for the default schemes are cached by the domain, see ElementLocationCache.
      */
     void giveLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
+    /**
+     * Evaluates the location array of receiver from its dof managers, bypassing the cache.
+     * @see giveLocationArray
+     */
+    void computeLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
     void giveLocationArray(IntArray &locationArray, const IntArray &dofIDMask, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
     /**
      * Returns the location array for the boundary of the element.
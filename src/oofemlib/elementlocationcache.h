@@ -0,0 +1,105 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef elementlocationcache_h
+#define elementlocationcache_h
+
+#include "oofemenv.h"
+#include "intarray.h"
+#include "statecountertype.h"
+
+#include <vector>
+#include <atomic>
+
+namespace oofem {
+class Domain;
+class Element;
+class UnknownNumberingScheme;
+
+/// Number of numbering schemes with cached location arrays (see UnknownNumberingScheme::giveLocationCacheIndex).
+#define ELEMENT_LOCATION_CACHE_SCHEMES 2
+
+/**
+ * Cache of element location arrays (code numbers) and master dof id arrays of a domain.
+ * For every cacheable numbering scheme, the arrays of all elements are concatenated in one flat buffer,
+ * so that assembly loops get them by a plain copy, without querying dof managers and without allocation.
+ *
+ * Each buffer is tagged by the equation numbering state counter of the domain, which is incremented
+ * whenever equations are renumbered. An outdated buffer is rebuilt on the first request, which may come
+ * from within a parallel assembly loop; concurrent requests wait for the rebuild.
+ */
+class OOFEM_EXPORT ElementLocationCache
+{
+protected:
+    /// Location arrays of all elements for one numbering scheme.
+    struct Table {
+        /// Numbering state the table was built for, -1 if never built.
+        std :: atomic< StateCounterType >state;
+        /// Offset of element arrays in codes and dofIds (size nelem+1).
+        std :: vector< int >start;
+        /// Concatenated location arrays.
+        std :: vector< int >codes;
+        /// Concatenated master dof ids.
+        std :: vector< int >dofIds;
+
+        Table() : state(-1) { }
+    };
+
+    /// Associated domain.
+    Domain *domain;
+    /// Tables of cacheable numbering schemes.
+    Table tables [ ELEMENT_LOCATION_CACHE_SCHEMES ];
+
+public:
+    /// Constructor.
+    ElementLocationCache(Domain *d) : domain(d) { }
+
+    /**
+     * Gives the cached location array of element.
+     * @param e Element, must belong to the domain.
+     * @param s Numbering scheme.
+     * @param locationArray Location array.
+     * @param dofIds If not NULL, master dof ids are returned.
+     * @return False if the scheme or element can not be served from the cache, answer is then left untouched.
+     */
+    bool giveLocationArray(const Element &e, const UnknownNumberingScheme &s, IntArray &locationArray, IntArray *dofIds);
+    /// Drops all cached arrays.
+    void clear();
+
+protected:
+    /// Rebuilds the table for given scheme, for given numbering state.
+    void rebuild(Table &table, const UnknownNumberingScheme &s, StateCounterType state);
+};
+} // end namespace oofem
+#endif // elementlocationcache_h
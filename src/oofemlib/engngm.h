@@ -58,6 +58,7 @@
 #include "exportmodulemanager.h"
 #include "initmodulemanager.h"
 #include "monitormanager.h"
+#include "fillreducingordering.h"
 #ifdef __MPM_MODULE
 #include "../mpm/integral.h"
 #endif
@@ -68,13 +69,19 @@
 
 #include <string>
 #include <memory>
+#ifdef __ASYNC_CONTEXT
+ #include <future>
+#endif
 
 ///@name Input fields for general Engineering models.
 //@{
 #define _IFT_EngngModel_nsteps "nsteps"
 #define _IFT_EngngModel_contextoutputstep "contextoutputstep"
+#define _IFT_EngngModel_contextFormat "contextformat" ///< 0 - plain stream, 1 - sectioned, 2 - sectioned and compressed
+#define _IFT_EngngModel_contextAsync "contextasync" ///< Write context files in background
 #define _IFT_EngngModel_renumberFlag "renumber"
 #define _IFT_EngngModel_profileOpt "profileopt"
+#define _IFT_EngngModel_ordering "ordering" ///< Equation ordering (0 - natural, 1 - Sloan, 2 - minimum degree, 3 - nested dissection, 4 - auto)
 #define _IFT_EngngModel_nmsteps "nmsteps"
 #define _IFT_EngngModel_nonLinFormulation "nonlinform"
 #define _IFT_EngngModel_eetype "eetype"
@@ -88,6 +95,7 @@
 #define _IFT_EngngModel_smtype "smtype"
 
 #define _IFT_EngngModel_suppressOutput "suppress_output" // Suppress writing to .out file
+#define _IFT_EngngModel_coloredAssembly "coloredassembly" // Lock-free parallel assembly over element colors
 
 //@}
 
@@ -229,6 +237,11 @@ protected:
     bool renumberFlag;
     /// Profile optimized numbering flag (using Sloan's algorithm).
     bool profileOpt;
+    /// Order in which dof managers are numbered; profileOpt selects EOT_Sloan.
+    EquationOrderingType equationOrdering;
+    /// Linear solver and sparse matrix types the automatic equation ordering is chosen for.
+    LinSystSolverType orderingSolverType;
+    SparseMtrxType orderingMatrixType;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
     /// Number of meta steps.
@@ -255,6 +268,16 @@ protected:
     /// Domain context output mode.
     ContextOutputMode contextOutputMode;
     int contextOutputStep;
+    /// Context file format (0 - plain stream, 1 - sectioned, 2 - sectioned and compressed), see ContextDataStream.
+    int contextFormat;
+    /// Flag for writing context files by background thread.
+    bool contextAsync;
+#ifdef __ASYNC_CONTEXT
+    /// Pending background write of context file.
+    std :: future< int >contextWriter;
+    /// Name of context file being written in background.
+    std :: string contextWriterFileName;
+#endif
 
     /// Export module manager.
     ExportModuleManager exportModuleManager;
@@ -328,6 +351,11 @@ protected:
     /// Flag for suppressing output to file.
     bool suppressOutput;
 
+    /// Flag for lock-free parallel assembly over element colors (effective only with OpenMP).
+    bool coloredAssemblyFlag;
+    /// Element colors for each domain, see giveElementColors.
+    std :: vector< std :: vector< IntArray > > elementColors;
+
     std::string simulationDescription;
 
 public:
@@ -481,6 +509,10 @@ public:
      * Saves context of given solution step, if required (determined using this->giveContextOutputMode() method).
      */
     void saveStepContext(TimeStep *tStep, ContextMode mode);
+    /**
+     * Waits until the context file being written in background (if any) is completed.
+     */
+    void finishContextOutput();
     /**
      * Updates internal state after finishing time step. (for example total values may be
      * updated according to previously solved increments). Then element values are also updated
@@ -796,6 +828,14 @@ public:
      * @param stepVersion Version of step.
      */
     std :: string giveContextFileName(int tStepNumber, int stepVersion) const;
+    /**
+     * Opens the context file of given step and version for reading.
+     * Both the plain and sectioned formats are recognized. Pending background writes are completed first.
+     * @param tStepNumber Solution step number to restore.
+     * @param stepVersion Version of step.
+     * @exception FileDataStream::CantOpen if the file can not be opened.
+     */
+    std :: unique_ptr< DataStream >giveContextInputStream(int tStepNumber, int stepVersion);
     /**
      * Returns the filename for the given domain (used by adaptivity and restore)
      * @param domainNum Domain number.
@@ -979,6 +1019,19 @@ public:
      */
     void assembleVectorFromElements(FloatArray &answer, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode,
                                     const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms = NULL);
+    /**
+     * Returns the element coloring of given domain. Elements of the same color share no dof manager
+     * (including the masters of slave dofs), so their contributions can be assembled concurrently without locking.
+     * Colors are assigned greedily in element order; the coloring is cached until the next equation renumbering.
+     * @param d Domain to color.
+     * @return List of colors, each containing element numbers.
+     */
+    const std :: vector< IntArray > &giveElementColors(Domain *d);
+    /**
+     * Returns true if assembly should be done concurrently over element colors.
+     * @param answer Target sparse matrix, NULL when assembling vectors.
+     */
+    bool useColoredAssembly(const SparseMtrx *answer = NULL) const;
 
     /**
      * Assembles characteristic vector of required type from boundary conditions.
@@ -42,6 +42,7 @@
 #include "set.h"
 
 #include <list>
+#include <functional>
 
 ///@name Input fields for export module
 //@{
@@ -133,6 +134,17 @@ public:
      * @param tStep time step.
      */
     void doForcedOutput(TimeStep *tStep) { doOutput(tStep, true); }
+    /**
+     * Captures the data needed for output of given time step.
+     * Modules that can serialize their output later return a task doing the writing. The task
+     * must not access the domain or the time step, as the analysis proceeds meanwhile; tasks of the
+     * same module are run one at a time and in order of capture.
+     * The default implementation writes the output at once by doOutput and returns no task.
+     * @param tStep Time step.
+     * @param forcedOutput If true, no testTimeStepOutput should be done.
+     * @return Write task, or empty function if the output has been already written.
+     */
+    virtual std :: function< void() >captureOutput(TimeStep *tStep, bool forcedOutput = false);
     /**
      * Initializes receiver.
      * The init file messages should be printed.
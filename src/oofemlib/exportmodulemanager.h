@@ -38,15 +38,64 @@
 #include "modulemanager.h"
 #include "exportmodule.h"
 
+#include <deque>
+#include <set>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+///@name Input fields for export module manager
+//@{
+#define _IFT_ExportModuleManager_exportThreads "exportthreads" ///< Number of background threads writing export files
+#define _IFT_ExportModuleManager_exportQueue "exportqueue" ///< Maximum number of captured outputs waiting for writing
+//@}
+
 namespace oofem {
 class EngngModel;
 
 /**
  * Class representing and implementing ExportModuleManager. It is attribute of EngngModel.
  * It manages the export output modules, which perform module - specific output operations.
+ *
+ * Output of a solution step proceeds in two phases. The data are first captured from the domain by
+ * the modules (ExportModule::captureOutput), then the returned write tasks are run. When export threads
+ * are requested, the tasks are queued and run by background threads while the analysis continues with
+ * the next step. The queue is bounded, the analysis waits when it is full. Tasks of the same module
+ * are run one at a time in order of capture, so that each module sees its outputs in sequence.
  */
 class OOFEM_EXPORT ExportModuleManager : public ModuleManager< ExportModule >
 {
+protected:
+    /// Write task of a module.
+    struct WriteTask {
+        ExportModule *module;
+        std :: function< void() >write;
+    };
+
+    /// Number of background writer threads, 0 writes output at once.
+    int numberOfThreads;
+    /// Maximum number of queued write tasks.
+    int maxQueueSize;
+    /// Background writer threads, started on first use.
+    std :: vector< std :: thread >workers;
+    /// Write tasks waiting for a worker.
+    std :: deque< WriteTask >queue;
+    /// Modules with a write task in progress.
+    std :: set< ExportModule * >busyModules;
+    /// Number of write tasks in progress.
+    int running;
+    /// Set when workers should finish.
+    bool stopWorkers;
+    /// First error raised by a write task.
+    std :: exception_ptr error;
+    /// Protects the queue and the state above.
+    std :: mutex queueMutex;
+    /// Signals changes of the queue state.
+    std :: condition_variable queueChanged;
+
 public:
     ExportModuleManager(EngngModel * emodel);
     virtual ~ExportModuleManager();
@@ -68,7 +117,20 @@ public:
      * Terminates the receiver, the corresponding terminate module services are called.
      */
     void terminate();
+    /**
+     * Waits until all queued output is written.
+     * Errors raised by write tasks are rethrown.
+     */
+    void flush();
     const char *giveClassName() const override { return "ExportModuleManager"; }
+
+protected:
+    /// Queues write task, waits while the queue is full.
+    void enqueue(ExportModule *module, std :: function< void() >write);
+    /// Main loop of writer threads.
+    void workerLoop();
+    /// Stops and joins writer threads, the queue must be empty.
+    void stopThreads();
 };
 } // end namespace oofem
 #endif // exportmodulemanager_h
@@ -0,0 +1,148 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef fillreducingordering_h
+#define fillreducingordering_h
+
+#include "oofemenv.h"
+#include "intarray.h"
+#include "linsystsolvertype.h"
+#include "sparsemtrxtype.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+class DofManager;
+class TimeStep;
+
+/// Graphs with more vertices than this are ordered by nested dissection in automatic mode.
+#define ORDERING_ND_THRESHOLD 4000
+/// Nested dissection stops bisecting subgraphs smaller than this and orders them by minimum degree.
+#define ORDERING_ND_LEAF_SIZE 200
+
+/**
+ * Type determining the order in which dof managers are asked for their equation numbers.
+ */
+enum EquationOrderingType {
+    EOT_Natural = 0,           ///< Dof managers numbered in input order (default).
+    EOT_Sloan = 1,             ///< Sloan profile and wavefront reduction, suits skyline storage.
+    EOT_MinimumDegree = 2,     ///< Approximate minimum degree, fill reducing.
+    EOT_NestedDissection = 3,  ///< Nested dissection with level-structure separators, fill reducing.
+    EOT_Auto = 4,              ///< Ordering recommended for the sparse matrix and linear solver in use.
+};
+
+/**
+ * Fill reducing renumbering of the dof manager graph.
+ * The graph contains the same vertices and edges as SloanGraph: domain dof managers, element and
+ * boundary condition internal dof managers, connected when they share an element or are linked
+ * through slave dofs. Each vertex is weighted by its number of primary dofs, so that the symbolic
+ * analysis predicts the size of the factor and the cost of factorization in terms of equations.
+ *
+ * Two orderings are provided:
+ * - Approximate minimum degree on the quotient graph (Amestoy, Davis, Duff, SIAM J. Matrix Anal. Appl. 17, 1996),
+ *   without supervariable detection.
+ * - Nested dissection, which recursively splits the graph by the smallest level of a rooted level structure
+ *   near its middle, numbers the separator last and orders small subgraphs by minimum degree.
+ *   No external partitioning library is needed.
+ */
+class OOFEM_EXPORT FillReducingOrdering
+{
+protected:
+    /// Domain associated to graph.
+    Domain *domain;
+    /// Dof managers corresponding to graph vertices.
+    std :: vector< DofManager * >dmans;
+    /// Vertex weights (number of primary dofs).
+    std :: vector< int >weights;
+    /// Start of the adjacency of each vertex in adjacency (size n+1).
+    std :: vector< int >adjStart;
+    /// Adjacent vertices (0-based, no self loops).
+    std :: vector< int >adjacency;
+    /// New position -> vertex (0-based).
+    std :: vector< int >order;
+
+public:
+    /// Constructor. Creates the graph associated to given domain.
+    FillReducingOrdering(Domain * d) : domain(d) { }
+
+    /// Builds the dof manager graph from domain description.
+    void initialize();
+    /// Returns number of graph vertices.
+    int giveNumberOfVertices() const { return ( int ) dmans.size(); }
+
+    /// Computes the approximate minimum degree ordering.
+    void computeMinimumDegreeOrdering();
+    /// Computes the nested dissection ordering.
+    void computeNestedDissectionOrdering();
+    /// Sets the ordering from a renumbering table (1-based old vertex numbers in new order), e.g. from SloanGraph.
+    void setOrdering(const IntArray &table);
+    /// Resets to the natural ordering.
+    void setNaturalOrdering();
+
+    /**
+     * Symbolic factorization of the current ordering.
+     * @param nnz Predicted number of nonzeros in the triangular factor, diagonal included.
+     * @param flops Predicted number of floating point operations of Cholesky factorization.
+     */
+    void computeFactorStatistics(long long &nnz, double &flops) const;
+    /// Assigns equation numbers to dof managers in the computed order.
+    void askNewEquationNumbers(TimeStep *tStep);
+
+    /**
+     * Resolves EOT_Auto to the ordering best suited to given sparse matrix storage and linear solver.
+     * Profile storages keep Sloan, sparse direct solvers get minimum degree or (on large graphs) nested dissection,
+     * iterative solvers keep the natural numbering.
+     */
+    static EquationOrderingType giveRecommendedOrdering(LinSystSolverType lstype, SparseMtrxType smtype, int nvertices);
+    /// Returns the name of ordering type.
+    static const char *giveOrderingName(EquationOrderingType type);
+
+protected:
+    /**
+     * Minimum degree ordering of the subgraph induced by given vertices.
+     * @param vertices Vertices to order.
+     * @param answer Ordered vertices are appended to this array.
+     */
+    void minimumDegree(const std :: vector< int > &vertices, std :: vector< int > &answer) const;
+    /// Recursive step of nested dissection on the subgraph induced by given vertices.
+    void dissect(std :: vector< int > &vertices, std :: vector< int > &part, std :: vector< int > &level, int &nextId, std :: vector< int > &answer) const;
+    /**
+     * Builds a rooted level structure of the subgraph of vertices with part[v] == id.
+     * @return Vertices in breadth first order; level[v] is set for each of them.
+     */
+    std :: vector< int >levelStructure(int root, int id, const std :: vector< int > &part, std :: vector< int > &level) const;
+};
+} // end namespace oofem
+#endif // fillreducingordering_h
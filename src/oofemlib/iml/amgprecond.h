@@ -0,0 +1,174 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef amgprecond_h
+#define amgprecond_h
+
+#include "precond.h"
+#include "floatmatrix.h"
+
+#include <vector>
+
+///@name Input fields for AMGPreconditioner
+//@{
+#define _IFT_AMGPrecond_theta "amgtheta" ///< Strength of connection threshold
+#define _IFT_AMGPrecond_sweeps "amgsweeps" ///< Number of pre- and post-smoothing Jacobi sweeps
+#define _IFT_AMGPrecond_coarsesize "amgcoarse" ///< Size of the coarsest level
+#define _IFT_AMGPrecond_maxlevels "amglevels" ///< Maximum number of levels
+//@}
+
+namespace oofem {
+class Domain;
+
+/// Levels with fewer rows than this are set up and smoothed sequentially.
+#define AMG_PARALLEL_THRESHOLD 2000
+/// Coarsest levels up to this size are solved by a dense inverse, larger ones by smoothing.
+#define AMG_DENSE_LIMIT 3000
+
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner
+ * (Vanek, Mandel, Brezina, Computing 56, 1996).
+ *
+ * Nodes (dof managers) are aggregated over the graph of strong block couplings, the near null space
+ * (rigid body modes of displacement and rotation dofs, constants for other fields) restricted to each
+ * aggregate is orthonormalized to give the tentative prolongator, which is smoothed by one damped
+ * Jacobi step. Coarse operators are Galerkin products @f$ P^{\mathrm{T}} A P @f$. The preconditioner
+ * applies one symmetric V-cycle with damped Jacobi smoothing, so it can be used with CG.
+ *
+ * When the matrix is reinitialized with an unchanged sparsity pattern (e.g. in Newton iterations), the
+ * aggregates and tentative prolongators are kept and only the smoothed prolongators and coarse operators
+ * are recomputed. Setup and V-cycles are parallelized with OpenMP.
+ *
+ * Supports CompCol and SymCompCol matrices. Without near null space the equations are aggregated
+ * individually with constant vectors.
+ */
+class OOFEM_EXPORT AMGPreconditioner : public Preconditioner
+{
+protected:
+    /// Sparse matrix in compressed row format, 0-based.
+    struct CSRMatrix {
+        int nrows = 0, ncols = 0;
+        std :: vector< int >rowStart, col;
+        std :: vector< double >val;
+
+        void times(const std :: vector< double > &x, std :: vector< double > &answer) const;
+        void transpose(CSRMatrix &answer) const;
+        void multiply(const CSRMatrix &b, CSRMatrix &answer) const;
+    };
+
+    /// One level of the hierarchy; the last level has no prolongator.
+    struct Level {
+        CSRMatrix A, Ptent, P, R;
+        /// Block (node) of each row.
+        std :: vector< int >block;
+        /// Inverted diagonal of A.
+        std :: vector< double >diagInv;
+        /// Jacobi damping.
+        double omega = 1.;
+        /// Work vectors of the V-cycle.
+        mutable std :: vector< double >x, b, r;
+    };
+
+    std :: vector< Level >levels;
+    /// Inverse of the coarsest operator (empty if coarsest level is smoothed only).
+    FloatMatrix coarseInverse;
+
+    /// Near null space (neq x nmodes), block of each equation.
+    FloatMatrix nullSpace;
+    std :: vector< int >nullSpaceBlock;
+
+    /// Strength of connection threshold.
+    double theta;
+    /// Number of smoothing sweeps.
+    int sweeps;
+    /// Maximum size of the coarsest level.
+    int coarseSize;
+    /// Maximum number of levels.
+    int maxLevels;
+
+public:
+    /// Constructor. Initializes the receiver (constructs the hierarchy) of given matrix.
+    AMGPreconditioner(const SparseMtrx & a, InputRecord & attributes);
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    AMGPreconditioner();
+    /// Destructor.
+    virtual ~AMGPreconditioner() { }
+
+    void init(const SparseMtrx &a) override;
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+
+    const char *giveClassName() const override { return "AMG"; }
+    void initializeFrom(InputRecord &ir) override;
+
+    /**
+     * Sets the near null space used to build the prolongators.
+     * @param modes Near null space vectors as columns, one row per equation.
+     * @param block Node (block) of each equation, equations of the same node are aggregated together.
+     */
+    void setNearNullSpace(const FloatMatrix &modes, const std :: vector< int > &block);
+    /**
+     * Sets the near null space from the dof managers of given domain: rigid body translations and rotations
+     * of displacement and rotation dofs, and constants of all other dof types.
+     * @param d Domain.
+     * @param neq Number of equations (default equation numbering) of the preconditioned matrix.
+     */
+    void setNearNullSpace(Domain *d, int neq);
+    /// Returns true if the near null space has been set.
+    bool hasNearNullSpace() const { return nullSpace.giveNumberOfRows() > 0; }
+
+protected:
+    /// Converts the matrix to full compressed row storage.
+    void giveCSR(const SparseMtrx &a, CSRMatrix &answer) const;
+    /**
+     * Aggregates the blocks of given level and builds its tentative prolongator.
+     * @param l Level index.
+     * @param B Near null space of the level (rows x nmodes).
+     * @param Bc Coarse near null space.
+     * @param coarseBlock Block of each coarse row.
+     */
+    bool buildTentativeProlongator(int l, const FloatMatrix &B, FloatMatrix &Bc, std :: vector< int > &coarseBlock);
+    /// Computes the smoothed prolongator, restriction and coarse operator of given level from its tentative prolongator.
+    void buildGalerkinOperator(int l);
+    /// Computes inverted diagonal and Jacobi damping of given level.
+    void computeSmoother(Level &level) const;
+    /// Solves the coarsest level.
+    void initCoarseSolver();
+    /// V-cycle on given level, x is overwritten.
+    void cycle(int l, const std :: vector< double > &b, std :: vector< double > &x) const;
+    /// Damped Jacobi sweeps on given level.
+    void smooth(const Level &level, const std :: vector< double > &b, std :: vector< double > &x, int n, bool zeroGuess) const;
+};
+} // end namespace oofem
+#endif // amgprecond_h
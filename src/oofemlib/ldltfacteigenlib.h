@@ -46,6 +46,9 @@
 #include "floatarray.h"
 #include <Eigen/Sparse>
 
+#include <memory>
+#include <vector>
+
 namespace oofem {
 class Domain;
 class EngngModel;
@@ -55,10 +58,35 @@ class FloatMatrix;
  * Implements the solution of linear system of equation in the form Ax=b using direct factorization method.
  * Can work with any sparse matrix implementation. However, the sparse matrix implementation have to support
  * its factorization (canBeFactorized method).
+ *
+ * The factorization is kept between calls. If the matrix (and its version) is unchanged, the existing factor is
+ * reused, so that several right hand sides cost only the back substitution. If only the values have changed,
+ * the ordering and symbolic analysis of the previous factorization are reused and only the numeric
+ * factorization is repeated; the complete analysis is done only when the sparsity pattern changes.
  */
 class OOFEM_EXPORT LDLTFactEigenLib : public SparseLinearSystemNM
 {
 private:
+    typedef Eigen::SimplicialLDLT< Eigen::SparseMatrix< double > > Factorization;
+
+    /// Last factorized matrix.
+    SparseMtrx *lhs;
+    /// Version of the last factorized matrix.
+    SparseMtrx :: SparseMtrxVersionType lhsVersion;
+    /// Factorization of the last matrix.
+    std :: unique_ptr< Factorization > factorization;
+    /// Column pointers of the sparsity pattern the symbolic analysis has been done for.
+    std :: vector< int > patternColumns;
+    /// Row indices of the sparsity pattern the symbolic analysis has been done for.
+    std :: vector< int > patternRows;
+
+    /**
+     * Updates the factorization for given matrix; skipped if the matrix is unchanged since last call.
+     * @return True if factorization succeeded.
+     */
+    bool factorize(SparseMtrx &A);
+    /// Returns true if the pattern of given matrix equals the pattern of the analyzed one.
+    bool hasAnalyzedPattern(const Eigen::SparseMatrix< double > &mtrx) const;
 
 public:
     /// Constructor - creates new instance of LDLTFactEigenLib, with number i, belonging to domain d and Engngmodel m.
@@ -76,6 +104,15 @@ public:
      * @return NM_Status value
      */
     virtual ConvergedReason solve(SparseMtrx &A, FloatArray &b, FloatArray &x);
+    /**
+     * Solves the given linear system with several right hand sides, using single factorization
+     * and multiple right hand side back substitution.
+     * @param A coefficient matrix
+     * @param B right hand sides (columns)
+     * @param X solution matrix
+     * @return NM_Status value
+     */
+    virtual ConvergedReason solve(SparseMtrx &A, FloatMatrix &B, FloatMatrix &X);
 
     virtual const char *giveClassName() const { return "LDLTFactEigenLib"; }
 	virtual LinSystSolverType giveLinSystSolverType() const { return ST_EigenLib; }
@@ -37,7 +37,6 @@
 #define masterdof_h
 
 #include "dof.h"
-#include "dictionary.h"
 #include "dofmanager.h"
 
 #include <cstdio>
@@ -48,6 +47,7 @@ class DofManager;
 class TimeStep;
 class BoundaryCondition;
 class InitialCondition;
+class DofUnknownStore;
 
 /**
  * Class representing "master" degree of freedom. Master is degree of freedom, which has
@@ -64,10 +64,9 @@ class InitialCondition;
  * This parameter is also used in member function giveUnknownType, which returns
  * CharType type according to DofID parameter.
  *
- * I don't know whether to implement following feature (now  not implemented)
- * 'unknowns' and 'pastUnknowns' are the dictionaries where the dof stores
- * its unknowns (e.g., the displacement 'd', the velocity 'v' and the acceleration 'a'),
- * at the current time step and at the previous one.
+ * Unknowns kept by the dof itself (e.g., the displacement 'd', the velocity 'v' and the acceleration 'a',
+ * at the current time step and at the previous one) are stored in a record of the DofUnknownStore
+ * of the domain, allocated on first write.
  *
  * TASKS
  * - Equation numbering, in method 'giveEquationNumber' and 'givePrescribedEquationNumber' ;
@@ -98,8 +97,10 @@ protected:
     int bc;
     /// Initial condition number associated to dof.
     int ic;
-    /// Unknowns dictionary to support changes of static system.
-    Dictionary unknowns;
+    /// Store holding the unknowns of receiver, to support changes of static system.
+    DofUnknownStore *unknownStore;
+    /// Record of receiver in unknownStore, -1 if not allocated.
+    int unknownRecord;
 
 public:
     /**
@@ -151,12 +152,17 @@ public:
     void setBcId(int bcId) override { this->bc = bcId; }
     void setIcId(int icId) override { this->ic = icId; }
     void setEquationNumber(int newEquationNumber) override { this->equationNumber = newEquationNumber; }
-    Dictionary *giveUnknowns() override { return &this->unknowns; }
+    bool hasUnknownsDictionaryEntry(int key) override;
+    double giveUnknownsDictionaryEntry(int key) override;
     int giveEqn() override { return equationNumber; }
 
 protected:
     BoundaryCondition *giveBc() override;
     InitialCondition *giveIc() override;
+    /// Returns the record of receiver in the unknown store of its domain, allocating it if necessary.
+    int giveUnknownRecord();
+    /// Returns true if receiver has a record in the unknown store of its domain.
+    bool hasUnknownRecord();
 };
 } // end namespace oofem
 #endif // masterdof_h
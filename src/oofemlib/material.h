@@ -39,6 +39,7 @@
 
 #include "matconst.h"
 #include "matstatus.h"
+#include "matstatusstore.h"
 #include "materialmode.h"
 #include "timestep.h"
 #include "internalstatetype.h"
@@ -116,6 +117,9 @@ protected:
     
     /// Material existing before casting time - optional parameter, zero by default
     int preCastingTimeMat;
+
+    /// Contiguous store of history variables of statuses opting in (see MaterialStatusStore).
+    mutable std :: shared_ptr< MaterialStatusStore >statusStore;
     
 
 public:
@@ -332,6 +336,13 @@ public:
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const
     { return nullptr; }
 
+    /**
+     * Returns the store of fixed-width status history variables of the receiver,
+     * creating it on first request. Used by statuses keeping their history in MaterialStatusSlot.
+     * @param width Number of history variables per integration point.
+     */
+    MaterialStatusStore *giveStatusStore(int width) const;
+
     /**
      * Initializes temporary variables stored in integration point status
      * at the beginning of new time step.
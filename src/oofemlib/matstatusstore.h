@@ -0,0 +1,141 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef matstatusstore_h
+#define matstatusstore_h
+
+#include "oofemenv.h"
+
+#include <vector>
+#include <memory>
+
+namespace oofem {
+/**
+ * Contiguous store of fixed-width history variables of material statuses.
+ *
+ * The store belongs to a material and keeps one slot per integration point, each holding
+ * the equilibrated and the temporary values of the history variables. Slots are allocated in
+ * blocks of contiguous memory, so their addresses do not change when new statuses are created.
+ *
+ * Material statuses opt in by keeping (some of) their history variables in a MaterialStatusSlot
+ * instead of separate members; their initTempStatus and updateYourself then copy the whole slot.
+ * The slots share the ownership of the store, so statuses may outlive the material.
+ */
+class OOFEM_EXPORT MaterialStatusStore : public std :: enable_shared_from_this< MaterialStatusStore >
+{
+protected:
+    /// Number of values in a slot.
+    int width;
+    /// Number of slots in a block.
+    int blockSize;
+    /// Blocks of slots, equilibrated values of all slots are followed by temporary ones.
+    std :: vector< std :: unique_ptr< double[] > >blocks;
+    /// Released slots available for reuse.
+    std :: vector< int >freeSlots;
+    /// Number of slots allocated so far (including released ones).
+    int numberOfSlots;
+
+public:
+    /**
+     * Constructor.
+     * @param width Number of history variables in a slot.
+     * @param blockSize Number of slots allocated together.
+     */
+    MaterialStatusStore(int width, int blockSize = 1024);
+
+    /// Returns number of history variables in a slot.
+    int giveWidth() const { return width; }
+    /// Returns number of slots in use.
+    int giveNumberOfSlots() const { return numberOfSlots - ( int ) freeSlots.size(); }
+
+    /**
+     * Allocates a new slot with zero values.
+     * @param values Equilibrated values of the slot.
+     * @param tempValues Temporary values of the slot.
+     * @return Index of the slot.
+     */
+    int allocate(double * &values, double * &tempValues);
+    /// Releases given slot for reuse.
+    void release(int slot);
+
+    /// Returns equilibrated values of given slot.
+    double *giveValues(int slot) { return blocks [ slot / blockSize ].get() + ( slot % blockSize ) * width; }
+    /// Returns temporary values of given slot.
+    double *giveTempValues(int slot) { return this->giveValues(slot) + blockSize * width; }
+};
+
+
+/**
+ * Fixed-width set of history variables of one material status.
+ * The values live in a slot of the material status store; statuses created without a store
+ * (e.g. for integration points not belonging to any element) keep them in own storage.
+ */
+class OOFEM_EXPORT MaterialStatusSlot
+{
+protected:
+    std :: shared_ptr< MaterialStatusStore >store;
+    int index;
+    int width;
+    double *values;
+    double *tempValues;
+    std :: unique_ptr< double[] >ownValues;
+
+public:
+    /**
+     * Constructor.
+     * @param width Number of history variables.
+     * @param store Store providing the slot, own storage is used if NULL.
+     */
+    MaterialStatusSlot(int width, MaterialStatusStore *store = NULL);
+    ~MaterialStatusSlot();
+    MaterialStatusSlot(const MaterialStatusSlot &) = delete;
+    MaterialStatusSlot &operator = ( const MaterialStatusSlot & ) = delete;
+
+    /// Returns i-th (0-based) equilibrated value.
+    double give(int i) const { return values [ i ]; }
+    /// Returns i-th (0-based) temporary value.
+    double giveTemp(int i) const { return tempValues [ i ]; }
+    /// Sets i-th equilibrated value.
+    void set(int i, double v) { values [ i ] = v; }
+    /// Sets i-th temporary value.
+    void setTemp(int i, double v) { tempValues [ i ] = v; }
+
+    /// Initializes temporary values to the equilibrated ones.
+    void initTemp();
+    /// Updates equilibrated values to the temporary ones.
+    void update();
+};
+} // end namespace oofem
+#endif // matstatusstore_h
@@ -71,10 +71,13 @@ public:
     /// Destructor.
     virtual ~NodalAveragingRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) override;
-
     const char *giveClassName() const override { return "NodalAveragingRecoveryModel"; }
 
+protected:
+    int computeValues(Set &elementSet, InternalStateType type, TimeStep *tStep) override;
+    /// Evaluates all variables in one (parallel) pass over the elements.
+    int computeValues(Set &elementSet, const IntArray &types, TimeStep *tStep, std :: vector< std :: shared_ptr< NodalValueTable > > &answer) override;
+
 private:
 #ifdef __MPI_PARALLEL_MODE
     void initCommMaps();
@@ -0,0 +1,95 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef nodalrecoverycache_h
+#define nodalrecoverycache_h
+
+#include "oofemenv.h"
+#include "floatarray.h"
+#include "intarray.h"
+#include "internalstatetype.h"
+#include "statecountertype.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace oofem {
+class Set;
+
+/// Recovered nodal values, the node number is the key.
+typedef std :: map< int, FloatArray >NodalValueTable;
+
+/**
+ * Domain level store of nodal values recovered by nodal recovery models.
+ * Export modules, fields and error estimators own their recovery models; the recovered tables are published here,
+ * so that a variable recovered on a region by one of them is not recovered again by the others.
+ * Tables are keyed by the recovery model class, the region and the internal state type. They are valid
+ * for one solution state only; storing a table for a newer state drops all the older ones.
+ */
+class OOFEM_EXPORT NodalRecoveryCache
+{
+protected:
+    /// Key: recovery model class name, region signature and internal state type.
+    typedef std :: tuple< std :: string, unsigned long, int >Key;
+    /// Stored table with the element list of its region (signatures are not unique).
+    struct Entry {
+        IntArray elements;
+        std :: shared_ptr< NodalValueTable >table;
+    };
+    /// Stored tables.
+    std :: map< Key, Entry >tables;
+    /// Solution state of stored tables.
+    StateCounterType stateCounter;
+
+public:
+    /// Constructor.
+    NodalRecoveryCache() : stateCounter(-1) { }
+
+    /**
+     * Returns the table recovered by given model, on given region, for given solution state, or NULL if not present.
+     */
+    std :: shared_ptr< NodalValueTable >giveTable(const char *model, Set &region, InternalStateType type, StateCounterType state) const;
+    /// Stores the recovered table.
+    void storeTable(const char *model, Set &region, InternalStateType type, StateCounterType state, std :: shared_ptr< NodalValueTable >table);
+    /// Drops all tables.
+    void clear();
+
+protected:
+    /// Returns a signature of given element list.
+    static unsigned long giveRegionSignature(const IntArray &elements);
+};
+} // end namespace oofem
+#endif // nodalrecoverycache_h
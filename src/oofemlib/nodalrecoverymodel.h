@@ -42,9 +42,11 @@
 #include "internalstatetype.h"
 #include "statecountertype.h"
 #include "set.h"
+#include "nodalrecoverycache.h"
 
 #include <map>
 #include <vector>
+#include <memory>
 
 namespace oofem {
 class Domain;
@@ -61,6 +63,9 @@ class ProblemCommunicator;
  * The element set can be set up in the input file, or created dynamically.
  * If Averaging over multiple regions is needed, multiple instances of nodal recovery model should be created,
  * o single instance reused.
+ *
+ * Recovered values are published in the NodalRecoveryCache of the domain, so that other recovery models
+ * of the same type (typically owned by other export modules) reuse them within the same solution state.
  */
 class OOFEM_EXPORT NodalRecoveryModel
 {
@@ -71,8 +76,9 @@ protected:
     /**
      * Map of nodal values. Only nodes for active region are determined and stored.
      * The node number is dictionary key to corresponding values.
+     * The table may be shared with the domain recovery cache and must not be modified once published.
      */
-    std :: map< int, FloatArray >nodalValList;
+    std :: shared_ptr< NodalValueTable >nodalValList;
     /// Determines the type of recovered values.
     InternalStateType valType;
     /// Time stamp of recovered values.
@@ -97,11 +103,20 @@ public:
     void setDomain(Domain *ipDomain) { domain = ipDomain; }
 
     /**
-     * Recovers the nodal values for all regions.
+     * Recovers the nodal values on given region, unless they are already known to receiver or to the domain recovery cache.
+     * @param elementSet Elements of the region.
      * @param type Determines the type of internal variable to be recovered.
      * @param tStep Time step.
      */
-    virtual int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) = 0;
+    int recoverValues(Set &elementSet, InternalStateType type, TimeStep *tStep);
+    /**
+     * Recovers the nodal values of several internal variables at once and publishes them in the domain recovery cache,
+     * where the subsequent calls of recoverValues for individual variables will find them.
+     * @param elementSet Elements of the region.
+     * @param types Types of internal variables to be recovered.
+     * @param tStep Time step.
+     */
+    int recoverValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
     /**
      * Clears the receiver's nodal table.
      * @return nonzero if o.k.
@@ -126,6 +141,23 @@ public:
     std :: string errorInfo(const char *func) { return std :: string(this->giveClassName()) + func; }
 
 protected:
+    /**
+     * Computes the nodal values on given region into receiver's nodal table.
+     * @param elementSet Elements of the region.
+     * @param type Determines the type of internal variable to be recovered.
+     * @param tStep Time step.
+     */
+    virtual int computeValues(Set &elementSet, InternalStateType type, TimeStep *tStep) = 0;
+    /**
+     * Computes the nodal values of several internal variables on given region.
+     * The default implementation recovers the variables one by one.
+     * @param elementSet Elements of the region.
+     * @param types Types of internal variables.
+     * @param tStep Time step.
+     * @param answer Recovered tables, in the order of types.
+     */
+    virtual int computeValues(Set &elementSet, const IntArray &types, TimeStep *tStep, std :: vector< std :: shared_ptr< NodalValueTable > > &answer);
+
     /**
      * Determine local region node numbering and determine and check nodal values size.
      * @param regionNodalNumbers on Return array containing for each dofManager its local region number.
@@ -41,9 +41,12 @@
 #include "grid.h"
 #include "mathfem.h"
 #include "dynamicinputrecord.h"
+#include "statecountertype.h"
 
 #include <list>
 #include <memory>
+#include <vector>
+#include <atomic>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -84,6 +87,49 @@ struct localIntegrationRecord {
     double weight;
 };
 
+/**
+ * Nonlocal interaction table of a material, stored in compressed row format.
+ * The integration points of default integration rules of all domain elements are numbered
+ * consecutively, element by element. Row of a point lists the influencing points (by their
+ * index) together with their integration weights, i.e., the values of weight function multiplied
+ * by volume around the influencing point. Rows are defined only for points of the owning material.
+ * The table thus represents the (unscaled) averaging operator, and the nonlocal averages of all
+ * points are obtained by a single sparse matrix-vector product with the vector of local values.
+ * Materials using the table keep no integration lists in their points.
+ */
+class OOFEM_EXPORT NonlocalInteractionTable
+{
+public:
+    /// Index of first point of each element, size is number of elements + 1.
+    std :: vector< int >elementOffset;
+    /// Integration points of the table.
+    std :: vector< GaussPoint * >points;
+    /// Start of each row in neighbours and weights, size is number of points + 1.
+    std :: vector< int >rowStart;
+    /// Indices of influencing points.
+    std :: vector< int >neighbours;
+    /// Integration weights of influencing points.
+    std :: vector< float >weights;
+    /// Integration volume (sum of weights) of each row.
+    std :: vector< double >scales;
+    /// Nonzero for points having their row defined.
+    std :: vector< char >rowFlags;
+    /// Nonzero for points influencing some point of the table.
+    std :: vector< char >sourceFlags;
+
+    /// Returns true if the table has not been built.
+    bool isEmpty() const { return rowStart.empty(); }
+    /// Clears the receiver.
+    void clear();
+    /// Returns the row of given integration point, -1 if point has no row in the table.
+    int giveRow(GaussPoint *gp) const;
+    /**
+     * Computes the product of the table with given vector of point values,
+     * only the rows of table are evaluated.
+     */
+    void multiply(std :: vector< double > &answer, const std :: vector< double > &x) const;
+};
+
   enum WeightFunctionType {
                            WFT_Unknown,
                            WFT_Bell,
@@ -262,9 +308,24 @@ protected:
     /// Parameter specifying how the weight function should be adjusted due to damage.
     int averType = 0;
 
+    /// Interaction table of receiver, used when nonlocal tables are permanent.
+    mutable NonlocalInteractionTable interactionTable;
+    /// Flag indicating that interaction table is built; set once the table is complete, so it can be tested without lock.
+    mutable std :: atomic< bool >interactionTableValid { false };
+    /// Local values of averaged variable, indexed by points of interaction table.
+    mutable std :: vector< double >localValues;
+    /// Nonlocal sums of averaged variable, indexed by points of interaction table.
+    mutable std :: vector< double >nonlocalSums;
+    /// Nonlocal update state counter of domain for which nonlocalSums have been evaluated.
+    mutable std :: atomic< StateCounterType >nonlocalSumsStateCounter { 0 };
+    /// Flag indicating that nonlocalSums have been evaluated.
+    mutable std :: atomic< bool >nonlocalSumsValid { false };
+
 #ifdef _OPENMP
  public:
     static omp_lock_t updateDomainBeforeNonlocAverageLock;
+ protected:
+    mutable omp_lock_t interactionTableLock;
 #endif
 public:
     /**
@@ -273,7 +334,7 @@ public:
      */
     NonlocalMaterialExtensionInterface(Domain *d);
     /// Destructor.
-    virtual ~NonlocalMaterialExtensionInterface() { }
+    virtual ~NonlocalMaterialExtensionInterface();
 
 
     /**
@@ -347,6 +408,37 @@ public:
      */
     std :: vector< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp) const;
 
+    /**
+     * Returns true if the nonlocal interactions of receiver are kept in interaction table instead of
+     * integration lists of points. Materials averaging through computeNonlocalSum enable it, typically
+     * when nonlocal tables are permanent. Default implementation returns false.
+     */
+    virtual bool hasInteractionTable() const { return false; }
+    /**
+     * Returns the interaction table of receiver. The table is built (in parallel) for all integration
+     * points of receiver on first request and reused until invalidated.
+     */
+    const NonlocalInteractionTable &giveInteractionTable() const;
+    /// Forces the rebuild of interaction table on next request (called by Domain when mesh is changed).
+    void invalidateInteractionTable() const;
+    /**
+     * Computes the weighted sum of local values over the interaction domain of given integration point,
+     * using the interaction table. The local values are requested by giveLocalValueForAverage and the sums
+     * for all points are evaluated at once, as product of the table with the vector of local values,
+     * for each state of domain. Therefore updateDomainBeforeNonlocAverage has to be called first.
+     * The integration scale of given point is set in its status.
+     * @param answer Weighted sum (not scaled).
+     * @param gp Integration point.
+     * @param tStep Time step.
+     * @return True if sum has been evaluated, false if interaction table is not available for given point.
+     */
+    bool computeNonlocalSum(double &answer, GaussPoint *gp, TimeStep *tStep) const;
+    /**
+     * Returns the local value of averaged variable in given integration point.
+     * Required by computeNonlocalSum, the default implementation issues an error.
+     */
+    virtual double giveLocalValueForAverage(GaussPoint *gp) const;
+
     /**
      * Evaluates the basic nonlocal weight function for a given distance
      * between interacting points. This function is NOT normalized by the
@@ -435,6 +527,16 @@ protected:
 
     void applyBarrierConstraints(const FloatArray &gpCoords, const FloatArray &jGpCoords, double &weight) const;
 
+    /**
+     * Evaluates the integration points influencing given point together with their integration weights.
+     * @param answer List of influencing points.
+     * @param integrationVolume Sum of integration weights.
+     * @param gp Integration point.
+     */
+    void computeNonlocalInteractions(std :: vector< localIntegrationRecord > &answer, double &integrationVolume, GaussPoint *gp) const;
+    /// Builds the interaction table of receiver.
+    void buildInteractionTable() const;
+
     /**
      * Manipulates weight on integration point in the element.
      * By default is off, keyword 'averagingtype' specifies various methods.
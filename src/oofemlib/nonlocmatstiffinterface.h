@@ -65,6 +65,17 @@ public:
      * receiver's associated integration point.
      */
     virtual std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) = 0;
+    /**
+     * Returns integration points influencing the nonlocal average in given point.
+     * Default implementation takes them from the integration list of the point.
+     */
+    virtual void NonlocalMaterialStiffnessInterface_giveInfluencingPoints(std :: vector< GaussPoint * > &answer, GaussPoint *gp)
+    {
+        answer.clear();
+        for ( auto &lir : * this->NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(gp) ) {
+            answer.push_back(lir.nearGp);
+        }
+    }
 
 #ifdef __OOFEG
     /**
@@ -71,6 +71,9 @@
 #define _IFT_NRSolver_forceScale "forcescale"
 #define _IFT_NRSolver_forceScaleDofs "forcescaledofs"
 #define _IFT_NRSolver_solutionDependentExternalForces "soldepextforces"
+#define _IFT_NRSolver_quasiNewton "quasinewton"
+#define _IFT_NRSolver_qnMaxUpdates "qnmaxupdates"
+#define _IFT_NRSolver_qnRefreshRatio "qnrefreshratio"
 //@}
 
 namespace oofem {
@@ -93,11 +96,17 @@ class EngngModel;
  * that is, the required condition, but the whole system remains symmetric and minimal
  * changes are necessary in the computational sequence.
  * The above artifice has been introduced by Payne and Irons.
+ *
+ * Optionally, the iterations with the kept (factorized) stiffness can be accelerated by limited-memory
+ * quasi-Newton updates of the inverse stiffness (BFGS for symmetric problems, Broyden for general ones).
+ * The tangent stiffness is then refreshed only when the residual reduction ratio exceeds given limit,
+ * when the update is not well defined or when the maximum number of stored updates is reached.
  */
 class OOFEM_EXPORT NRSolver : public SparseNonLinearSystemNM
 {
 protected:
     enum nrsolver_ModeType { nrsolverModifiedNRM, nrsolverFullNRM, nrsolverAccelNRM };
+    enum nrsolver_QuasiNewtonType { nrsolverNoQN, nrsolverBFGS, nrsolverBroyden };
 
     int nsmax, minIterations;
     double minStepLength;
@@ -164,6 +173,27 @@ protected:
     std :: map< int, double >dg_forceScale;
 
     double maxIncAllowed;
+
+    /// Quasi-Newton update of the kept stiffness.
+    nrsolver_QuasiNewtonType qnMode;
+    /// Maximum number of stored updates, the tangent is refreshed when reached.
+    int qnMaxUpdates;
+    /// Residual norm ratio of two subsequent iterations above which the tangent is refreshed.
+    double qnRefreshRatio;
+    /// Stored increments.
+    std :: vector< FloatArray >qnS;
+    /// Residual changes (BFGS) or correction vectors (Broyden) of stored updates.
+    std :: vector< FloatArray >qnY;
+    /// Reciprocal curvatures of BFGS updates.
+    std :: vector< double >qnRho;
+    /// Residual, unscaled iterative direction, increment and residual norm of the previous iteration.
+    FloatArray qnLastRhs, qnLastDir, qnLastStep;
+    double qnLastNorm;
+    /// Flag indicating that the previous iteration can be used to form a new update.
+    bool qnPending;
+    /// Number of updates and tangent refreshes in the last solution step.
+    int qnNumUpdates, qnNumRefreshes;
+
 public:
     NRSolver(Domain *d, EngngModel *m);
     virtual ~NRSolver();
@@ -203,6 +233,14 @@ protected:
     /// Initiates prescribed equations
     void initPrescribedEqs();
     void applyConstraintsToStiffness(SparseMtrx &k);
+    /**
+     * Computes the iterative increment using the kept stiffness and the stored quasi-Newton updates.
+     * The stored updates are extended by the previous iteration, or the tangent stiffness is refreshed
+     * if the convergence is too slow or the update is not well defined.
+     */
+    void solveQuasiNewton(SparseMtrx &k, FloatArray &rhs, FloatArray &ddX, TimeStep *tStep);
+    /// Refreshes the tangent stiffness and discards the stored quasi-Newton updates.
+    void refreshQuasiNewtonTangent(SparseMtrx &k, TimeStep *tStep);
     void applyConstraintsToLoadIncrement(int nite, const SparseMtrx &k, FloatArray &R,
                                          referenceLoadInputModeType rlm, TimeStep *tStep);
 
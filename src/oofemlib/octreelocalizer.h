@@ -40,10 +40,8 @@
 #include "floatarray.h"
 #include "intarray.h"
 
-#include <set>
 #include <list>
 #include <vector>
-#include <memory>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -62,88 +60,45 @@ class OctreeSpatialLocalizer;
 
 /**
  * Class representing the octant of octree.
- * It maintains the link to parent cell or if it it the root cell, this link pointer is set to NULL.
- * Maintains links to possible child octree cells as well as its position and size.
- * Also list of node numbers contained in given octree cell can be maintained if cell is terminal cell.
+ * Octants are stored in a flat array owned by the localizer and refer to each other by their index.
+ * The children of an octant are stored consecutively, ordered by their (x,y,z) local position,
+ * so the child index is determined directly from the position of a point relative to the octant origin.
+ * Each octant refers to a contiguous range of nodes in the node list of the localizer; the nodes
+ * are sorted in depth-first order of the tree (terminal octants in order of their child indices, nodes
+ * within a terminal octant in order of their numbers), so the range of an octant covers its whole subtree.
  */
 class OOFEM_NO_EXPORT OctantRec
 {
-protected:
-    /// Link to parent cell record.
-    OctantRec *parent;
-    /// Link to octant children.
-    std::unique_ptr<OctantRec> child [ 2 ] [ 2 ] [ 2 ];
-    //std::unique_ptr<OctantRec[2][2][2]> child2;
-    /// Octant origin coordinates (lower corner)
-    FloatArray origin;
-    /// Octant size.
-    double halfWidth;
-    /// Tree depth
-    int depth;
-
-    /// Octant node list.
-    std :: list< int > nodeList;
-    /// Element list, containing all elements having IP in cell.
-    IntArray elementIPList;
-    /// Element list of all elements close to the cell.
-    std :: vector< std :: list< int > >elementList;
-
-
 public:
     enum BoundingBoxStatus { BBS_OutsideCell, BBS_InsideCell, BBS_ContainsCell };
-    enum ChildStatus { CS_ChildFound, CS_NoChild };
 
-    /// Constructor.
-    OctantRec(OctantRec * parent, FloatArray origin, double halfWidth);
-    /// Destructor.
-    ~OctantRec() {}
+    /// Octant origin coordinates (center).
+    double origin [ 3 ];
+    /// Octant size.
+    double halfWidth;
+    /// Tree depth.
+    int depth;
+    /// Index of parent octant, -1 for root.
+    int parent;
+    /// Index of first child octant, -1 for terminal octant.
+    int firstChild;
+    /// Range of octant nodes in node list of localizer.
+    int nodeStart, nodeEnd;
 
-    /// @return Reference to parent; NULL if root.
-    OctantRec *giveParent() { return this->parent; }
-    /**
-     * Gives the cell origin.
-     * @param answer Cell origin.
-     */
-    const FloatArray & giveOrigin() { return this->origin; }
-    /// @return Half the cell width.
-    double giveWidth() { return 2. * this->halfWidth; }
+    /// @return True if octant is terminal (no children).
+    bool isTerminalOctant() const { return firstChild < 0; }
+    /// @return Cell width.
+    double giveWidth() const { return 2. * this->halfWidth; }
     /// @return Depth in the tree for this octant.
-    int giveCellDepth() { return this->depth; }
+    int giveCellDepth() const { return this->depth; }
     /**
-     * Gives the Child at given local indices.
-     * @param xi First index.
-     * @param yi Second index.
-     * @param zi Third index.
-     * @return Child cell with given local cell coordinates.
-     */
-    OctantRec *giveChild(int xi, int yi, int zi);
-    /**
-     * Returns the child containing given point.
+     * Returns local index of the child containing given point.
      * If not full 3d coordinates are provided, then only provided coordinates are taken into account,
      * assuming remaining to be same as origin.
-     * If point is contained by receiver, corresponding child is set, otherwise.
-     * child is set to NULL.
-     * @param child
      * @param coords Coordinate which child should contain.
      * @param mask Mask for which dimensions are in used (size 3, 0 or 1 values)
-     * @return Child status.
-     */
-    ChildStatus giveChildContainingPoint(OctantRec *&child, const FloatArray &coords, const IntArray &mask);
-    /// @return True if octant is terminal (no children).
-    bool isTerminalOctant();
-    /// @return Reference to node List.
-    std :: list< int > &giveNodeList();
-    /// @return Reference to IPelement set.
-    IntArray &giveIPElementList();
-    /// @return Reference to closeElement list.
-    std :: list< int > &giveElementList(int region);
-
-    /**
-     * Divide receiver further, creating corresponding children.
-     * @param level Depth of tree.
-     * @param octantMask Masking of dimensions.
      */
-    void divideLocally(int level, const IntArray &octantMask);
+    int giveChildIndex(const FloatArray &coords, const IntArray &mask) const;
     /**
      * Test if receiver within bounding box (sphere).
      * @param coords Center of sphere.
@@ -151,33 +106,7 @@ public:
      * @param mask Mask for which dimensions are in used (size 3, 0 or 1 values)
      * @return BoundingBoxStatus status.
      */
-    BoundingBoxStatus testBoundingBox(const FloatArray &coords, double radius, const IntArray &mask);
-    /**
-     * Adds given element to cell list of elements having IP within this cell.
-     * @param elementNum Element number to add.
-     */
-    void addElementIP(int elementNum) { this->giveIPElementList().insertSortedOnce(elementNum); }
-    /**
-     * Adds given element to cell list of elements having IP within this cell.
-     * @param region Element region number (0 for global).
-     * @param elementNum Element number to add.
-     */
-    void addElement(int region, int elementNum) { this->giveElementList(region).push_back(elementNum); }
-    /**
-     * Adds given Node to node list of nodes contained by receiver.
-     * @param nodeNum Node number to add.
-     */
-    void addNode(int nodeNum) { this->giveNodeList().push_back(nodeNum); }
-    /**
-     * Clears and deletes the nodeList.
-     */
-    void deleteNodeList() {
-        nodeList.clear();
-    }
-    /// Recursively prints structure.
-    void printYourself();
-    /// Error printing helper.
-    std :: string errorInfo(const char *func) const { return std :: string("OctantRec") + func; }
+    BoundingBoxStatus testBoundingBox(const FloatArray &coords, double radius, const IntArray &mask) const;
 };
 
 
@@ -188,12 +117,28 @@ public:
  * nodal connectivity informations provided by ConTable.
  * Typical services include searching the closes node to give position, searching of an element containing given point, etc.
  * If special element algorithms required, these should be included using interface concept.
+ *
+ * The tree is linearized; octants are kept in single array and the lists of nodes and elements attached
+ * to terminal octants are stored in compressed (CSR) form. Once initialized, the queries do not modify
+ * the receiver and can be called concurrently.
  */
 class OOFEM_EXPORT OctreeSpatialLocalizer : public SpatialLocalizer
 {
 protected:
-    /// Root cell of octree.
-    std::unique_ptr<OctantRec> rootCell;
+    /// Octree cells, root cell is the first one.
+    std :: vector< OctantRec >cells;
+    /// Node numbers, sorted in octree order.
+    std :: vector< int >nodeList;
+    /// Terminal cell containing node, indexed by node number - 1 (-1 for dof managers which are not nodes).
+    std :: vector< int >nodeCell;
+    /// Offsets into cellIPElements for each cell (CSR format).
+    std :: vector< int >cellIPElementStart;
+    /// Elements having IP (or node) in cell, sorted for each cell.
+    std :: vector< int >cellIPElements;
+    /// Offsets into cellElements for each region and cell (CSR format).
+    std :: vector< std :: vector< int > >cellElementStart;
+    /// Elements whose bounding box overlaps the cell, for each region.
+    std :: vector< std :: vector< int > >cellElements;
     /// Octree degenerate mask.
     IntArray octreeMask;
     /// Flag indicating elementIP tables are initialized.
@@ -202,14 +147,14 @@ protected:
     bool initialized;
 #ifdef _OPENMP
     omp_lock_t initLock;
-    omp_lock_t buildOctreeDataStructureLock;
     omp_lock_t ElementIPDataStructureLock;
+    omp_lock_t elementDataStructureLock;
 #endif
 public:
     /// Constructor
     OctreeSpatialLocalizer(Domain * d);
     /// Destructor - deletes the octree tree
-    virtual ~OctreeSpatialLocalizer() {}
+    virtual ~OctreeSpatialLocalizer();
 
     /**
      * Returns the octreeMask value given by the index
@@ -221,6 +166,9 @@ public:
     /**
      * Initialize receiver data structure if not done previously.
      * Current implementation calls and returns the buildOctreeDataStructure service response.
+     * When forced (e.g. after mesh movement) and all nodes remained within the root octant, the tree topology is
+     * kept, the moved nodes are redistributed to terminal octants and only the overfull ones are subdivided.
+     * The element tables are rebuilt.
      */
     int init(bool force = false) override;
 
@@ -231,6 +179,10 @@ public:
     GaussPoint *giveClosestIP(const FloatArray &coords, int region, bool iCohesiveZoneGP = false) override;
     GaussPoint *giveClosestIP(const FloatArray &coords, Set &elemSet, bool iCohesiveZoneGP = false) override;
 
+    void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords,
+                                      const IntArray *regionList = nullptr) override;
+    void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, int region) override;
+
     void giveAllElementsWithIpWithinBox_EvenIfEmpty(elementContainerType &elemSet, const FloatArray &coords, const double radius) override { giveAllElementsWithIpWithinBox_EvenIfEmpty(elemSet, coords, radius, false); }
     void giveAllElementsWithIpWithinBox(elementContainerType &elemSet, const FloatArray &coords, const double radius) override { giveAllElementsWithIpWithinBox(elemSet, coords, radius, false); }
     void giveAllElementsWithIpWithinBox_EvenIfEmpty(elementContainerType &elemSet, const FloatArray &coords, const double radius, bool iCohesiveZoneGP);
@@ -248,11 +200,30 @@ protected:
      * - if number of nodes exceed threshold, cell is subdivided.
      * - there is maximal octree level.
      * - in current implementation, the neighbor cell size difference is allowed to be > 2.
+     * @param force If true, existing tree is updated for current node positions.
+     */
+    bool buildOctreeDataStructure(bool force = false);
+    /**
+     * Updates the tree for moved nodes: nodes are reassigned to terminal cells of existing tree,
+     * which are subdivided if they became overfull. Cells are never merged.
+     * @param nnode Total number of dof managers in domain.
      */
-    bool buildOctreeDataStructure();
+    void redistributeNodes(int nnode);
+    /**
+     * Assigns node ranges to cells of subtree in depth-first order.
+     * @param cell Root of subtree.
+     * @param count Number of nodes in each terminal cell.
+     * @param pos Position in node list, advanced past the subtree.
+     */
+    void assignNodeRanges(int cell, const std :: vector< int > &count, int &pos);
+    /**
+     * Subdivides given cell recursively, distributing its nodes to children.
+     * @param cell Index of cell.
+     * @param nnode Total number of dof managers in domain.
+     */
+    void divideCell(int cell, int nnode);
     /**
      * Insert IP records into tree (the tree topology is determined by nodes).
-     * @return Nonzero if successful, otherwise zero.
      */
     void initElementIPDataStructure();
     /**
@@ -263,46 +234,17 @@ protected:
      * Finds the terminal octant containing the given point.
      * @param startCell Cell used to start search.
      * @param coords Coordinates of point of interest.
-     * @return Pointer to terminal octant, NULL if point outside startingCell.
-     */
-    OctantRec *findTerminalContaining(OctantRec &startCell, const FloatArray &coords);
-    /**
-     * Inserts the given node (identified by its number and position) to the octree structure.
-     * The tree is traversed until terminal octant containing given position is found and node is then inserted
-     * into octant nodal list. If there is too much nodes per cell, this is subdivided further and
-     * its assigned nodes are propagated to children.
-     * @param rootCell Starting cell for insertion.
-     * @param nodeNum Node number.
-     * @param coords Corresponding node coordinates.
+     * @return Index of terminal octant.
      */
-    void insertNodeIntoOctree(OctantRec &rootCell, int nodeNum, const FloatArray &coords);
+    int findTerminalContaining(int startCell, const FloatArray &coords) const;
     /**
-     * Inserts the given integration point (or more precisely the element owning it) to the octree data structure.
-     * The tree is traversed until terminal octant containing given position (ip coordinates) is found
-     * and corresponding entry is then inserted into corresponding octant list.
-     * @param rootCell Starting cell for insertion.
-     * @param elemNum Element number.
-     * @param coords Global IP coordinates.
-     */
-    void insertIPElementIntoOctree(OctantRec &rootCell, int elemNum, const FloatArray &coords);
-    /**
-     * Inserts an element with the given bounding box.
-     * @param rootCell Starting cell for insertion.
-     * @param region Element region number.
-     * @param elemNum Element number.
+     * Collects terminal cells overlapping given element bounding box.
+     * @param answer Terminal cells.
+     * @param cell Starting cell.
      * @param b0 Lower bounding box.
      * @param b1 Upper bounding box.
      */
-    void insertElementIntoOctree(OctantRec &rootCell, int region, int elemNum, const FloatArray &b0, const FloatArray &b1);
-    /**
-     * Initializes the element lists  in octree data structure.
-     * This implementation requires that the list of nodes in terminate cells exists
-     * simply all shared elements to nodes in terminal cell are added.
-     * If this is added to existing implementation based on adding elements only if integration point is in the cell.
-     * this leads to more complete element list in terminal cell.
-     * @param rootCell Starting cell for octree transversal.
-     */
-    void insertElementsUsingNodalConnectivitiesIntoOctree(OctantRec &rootCell);
+    void giveTerminalCellsOverlappingBBox(std :: vector< int > &answer, int cell, const FloatArray &b0, const FloatArray &b1) const;
     /**
      * Returns container (set) of elements having integration point within given box and given root cell.
      * @param elemSet answer containing the list of elements meeting the criteria.
@@ -310,7 +252,7 @@ protected:
      * @param coords Center of box of interest.
      * @param radius Radius of bounding sphere.
      */
-    void giveElementsWithIPWithinBox(elementContainerType &elemSet, OctantRec &currentCell,
+    void giveElementsWithIPWithinBox(elementContainerType &elemSet, int currentCell,
                                      const FloatArray &coords, const double radius, bool iCohesiveZoneGP = false);
     /**
      * Returns container (list) of nodes within given box and given root cell.
@@ -319,52 +261,42 @@ protected:
      * @param coords Center of box of interest.
      * @param radius Radius of bounding sphere.
      */
-    void giveNodesWithinBox(nodeContainerType &nodeList, OctantRec &currentCell,
+    void giveNodesWithinBox(nodeContainerType &nodeList, int currentCell,
                             const FloatArray &coords, const double radius);
-
     /**
-     * Returns closest IP to given point contained within given octree cell.
-     * @param currentCell Starting cell to search, all children will be searched too
+     * Returns closest IP to given point contained within given terminal octree cell.
+     * @param currentCell Terminal cell to search.
      * @param coords Point coordinates.
      * @param region Region id of elements.
+     * @param elemSet Set of considered elements, if NULL, region is used instead.
      * @param dist Threshold distance, only update answer param, if distance is smaller, distance is updated too.
      * @param answer Pointer to IP, which has the smallest distance "distance" from given point.
+     * @param strict If true, only strictly closer IPs update the answer.
      */
-    void giveClosestIPWithinOctant(OctantRec &currentCell, //elementContainerType& visitedElems,
-                                   const FloatArray &coords,
-                                   int region, double &dist, GaussPoint *&answer, bool iCohesiveZoneGP);
+    void giveClosestIPWithinOctant(int currentCell, const FloatArray &coords, int region, const Set *elemSet,
+                                   double &dist, GaussPoint *&answer, bool iCohesiveZoneGP, bool strict);
     /**
-     * Returns closest IP to given point contained within given octree cell.
-     * @param currentCell Starting cell to search, all children will be searched too
+     * Returns closest IP to given point.
      * @param coords Point coordinates.
-     * @param elemSet set of considered elements.
-     * @param dist Threshold distance, only update answer param, if distance is smaller, distance is updated too.
-     * @param answer Pointer to IP, which has the smallest distance "distance" from given point.
+     * @param region Region id of elements.
+     * @param elemSet Set of considered elements, if NULL, region is used instead.
      */
-    void giveClosestIPWithinOctant(OctantRec &currentCell, //elementContainerType& visitedElems,
-                                   const FloatArray &coords,
-                                   Set &elemSet, double &dist, GaussPoint *&answer, bool iCohesiveZoneGP);
+    GaussPoint *giveClosestIP(const FloatArray &coords, int region, const Set *elemSet, bool iCohesiveZoneGP);
     /**
      * Returns the element containing given point.
      * The search is done only for given cell and its children, skipping the given child from search
      * @param cell Top level cell to search.
      * @param coords Point coordinates.
-     * @param scannedChild Child pointer to exclude from search.
+     * @param scannedChild Child to exclude from search (-1 for none).
      * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
-     * @note regions depreceted, use sets insteed
+     * @param elset Only elements in given set are considered, if NULL all elements are considered.
      */
-    Element *giveElementContainingPoint(OctantRec &cell, const FloatArray &coords,
-                                        OctantRec *scannedChild = nullptr, const IntArray *regionList = nullptr);
+    Element *giveElementContainingPoint(int cell, const FloatArray &coords, int scannedChild,
+                                        const IntArray *regionList, const Set *elset);
     /**
-     * Returns the element containing given point.
-     * The search is done only for given cell and its children, skipping the given child from search
-     * @param cell Top level cell to search.
-     * @param coords Point coordinates.
-     * @param scannedChild Child pointer to exclude from search.
-     * @param elset Only elements in gibven set are considered, if NULL all regions are considered.
+     * Returns the element containing given point, searching from the terminal cell containing it upwards.
      */
-    Element *giveElementContainingPoint(OctantRec &cell, const FloatArray &coords,
-                                        OctantRec *scannedChild = nullptr, const Set *elset = nullptr);
+    Element *findElementContainingPoint(const FloatArray &coords, const IntArray *regionList, const Set *elset);
     /**
      * Returns the element closest to the given point within the cell.
      * @param currCell Terminal cell to look in.
@@ -375,7 +307,7 @@ protected:
      * @param answer Requested element.
      * @param region Region to consider.
      */
-    void giveElementClosestToPointWithinOctant(OctantRec &currCell, const FloatArray &gcoords,
+    void giveElementClosestToPointWithinOctant(int currCell, const FloatArray &gcoords,
                                                double &minDist, FloatArray &lcoords, FloatArray &closest, Element * &answer, int region);
     /**
      * Returns the node closest to the given point within the cell.
@@ -384,26 +316,22 @@ protected:
      * @param[in,out] minDist Distance from the center of returned element.
      * @param answer Requested node.
      */
-    void giveNodeClosestToPointWithinOctant(OctantRec &cell, const FloatArray &gcoords, double &minDist, Node * &answer);
+    void giveNodeClosestToPointWithinOctant(int cell, const FloatArray &gcoords, double &minDist, Node * &answer);
     /**
-     * Determines the max tree depth computed for given tree cell and its children.
-     * To obtain total tree depth, root cell should be supplied.
-     * The tree depth is always measured from the root cell.
-     * Before call, maxDepth should be set to zero.
-     * @param root Root of tree.
-     * @return The maximum depth in the tree from the given root
+     * Determines the max tree depth.
+     * @return The number of tree levels.
      */
-    int giveMaxTreeDepthFrom(OctantRec &root);
+    int giveMaxTreeDepth();
     /**
      * Builds the list of terminal cells contained within given box (coords, radius), starting from given currentCell.
-     * @param cellList List of terminal cell pointers contained by bounding box.
+     * @param cellList List of terminal cells contained by bounding box.
      * @param coords Center of box of interest.
      * @param radius Radius of bounding sphere.
-     * @param innerRadius Inner radius of bounding sphere.
+     * @param innerRadius Inner radius of bounding sphere, cells overlapping the inner sphere are skipped (if positive).
      * @param currentCell Starting cell.
      */
-    void giveListOfTerminalCellsInBoundingBox(std :: list< OctantRec * > &cellList, const FloatArray &coords,
-                                              const double radius, double innerRadius, OctantRec &currentCell);
+    void giveListOfTerminalCellsInBoundingBox(std :: vector< int > &cellList, const FloatArray &coords,
+                                              const double radius, double innerRadius, int currentCell);
 };
 } // end namespace oofem
 #endif // octreelocalizer_h
@@ -0,0 +1,150 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef oofembindatareader_h
+#define oofembindatareader_h
+
+#include "datareader.h"
+#include "oofembininputrecord.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace oofem {
+class OOFEMTXTDataReader;
+
+/**
+ * Class representing the reader of binary (fast-load) input files.
+ * The binary file contains the records of the OOFEM text input already tokenized, with the tokens
+ * stored as columnar arrays (numeric value, string id, flags) over all records. Numeric tokens are
+ * parsed once during conversion, and other tokens are interned into a string table, so field
+ * lookups are integer comparisons and no string parsing happens while the model is instantiated.
+ * The file is memory-mapped and accessed in place.
+ *
+ * The binary file is produced from the text input by convert (oofem -tobin option).
+ * As for OOFEMTXTDataReader, the records are returned in the order in which they are stored.
+ *
+ * Layout (native byte order, each array aligned to 8 bytes):
+ * header (magic, version, number of strings, records and tokens),
+ * token doubles, token integers, token string ids, record token offsets, record line numbers,
+ * string offsets, token flags, string data.
+ */
+class OOFEM_EXPORT OOFEMBinDataReader : public DataReader
+{
+public:
+    /// Token flags.
+    enum TokenFlag : std :: uint8_t {
+        TF_Int = 1, ///< Token is an integer number.
+        TF_Double = 2, ///< Token is a floating point number.
+    };
+
+protected:
+    std :: string dataSourceName;
+    /// Mapped (or loaded) file contents.
+    const char *data;
+    std :: size_t dataSize;
+    /// Fallback storage when memory mapping is not available.
+    std :: vector< char >buffer;
+
+    int nstrings, nrecords, ntokens;
+    const double *tokenDouble;
+    const std :: int32_t *tokenInt;
+    const std :: int32_t *tokenString;
+    const std :: int32_t *recordStart;
+    const std :: int32_t *recordLine;
+    const std :: int32_t *stringOffset;
+    const std :: uint8_t *tokenFlags;
+    const char *strings;
+
+    /// Map from interned strings to their ids.
+    std :: unordered_map< std :: string, int >stringIds;
+    /// Cache of keyword ids, indexed by keyword pointer (keywords are mostly string literals).
+    mutable std :: unordered_map< const char *, std :: pair< int, std :: string > >keywordCache;
+
+    /// Index of next record.
+    int current;
+    /// Current record.
+    OOFEMBinInputRecord record;
+    /// Records returned by giveInputRecords.
+    std :: vector< OOFEMBinInputRecord >block;
+
+public:
+    /// Constructor. Maps given binary input file.
+    OOFEMBinDataReader(std :: string inputfilename);
+    OOFEMBinDataReader(const OOFEMBinDataReader &) = delete;
+    OOFEMBinDataReader &operator = ( const OOFEMBinDataReader & ) = delete;
+    virtual ~OOFEMBinDataReader();
+
+    InputRecord &giveInputRecord(InputRecordType, int recordId) override;
+    void giveInputRecords(std :: vector< InputRecord * > &answer, InputRecordType irType, int count) override;
+    bool peakNext(const std :: string &keyword) override;
+    void finish() override;
+    std :: string giveReferenceName() const override { return dataSourceName; }
+
+    /// Returns true if given file is a binary input file.
+    static bool isBinaryInput(const std :: string &filename);
+    /**
+     * Converts text input to binary input file.
+     * @param reader Text reader with all records of the input.
+     * @param filename Name of binary file.
+     * @return Nonzero if successful.
+     */
+    static int convert(const OOFEMTXTDataReader &reader, const std :: string &filename);
+
+    /**
+     * @name Token access.
+     * Tokens are numbered from 0 over the whole file.
+     */
+    //@{
+    int giveRecordStart(int irec) const { return recordStart [ irec ]; }
+    int giveRecordSize(int irec) const { return recordStart [ irec + 1 ] - recordStart [ irec ]; }
+    int giveRecordLine(int irec) const { return recordLine [ irec ]; }
+    int giveTokenFlags(int itok) const { return tokenFlags [ itok ]; }
+    int giveTokenInt(int itok) const { return tokenInt [ itok ]; }
+    double giveTokenDouble(int itok) const { return tokenDouble [ itok ]; }
+    /// Returns the string id of token, or -1 for numeric tokens.
+    int giveTokenStringId(int itok) const { return tokenString [ itok ]; }
+    const char *giveString(int id) const { return strings + stringOffset [ id ]; }
+    /// Returns the string id of given keyword, or -1 if it does not appear in the file. Thread safe.
+    int giveKeywordId(const char *kwd) const;
+    //@}
+
+protected:
+    /// Sets the array pointers from mapped data.
+    void setupArrays();
+};
+} // end namespace oofem
+#endif // oofembindatareader_h
@@ -0,0 +1,104 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef oofembininputrecord_h
+#define oofembininputrecord_h
+
+#include "inputrecord.h"
+
+#include <string>
+#include <vector>
+
+namespace oofem {
+class OOFEMBinDataReader;
+
+/**
+ * Class representing the Input Record of binary (pre-tokenized) input file.
+ * The record refers to the tokens stored in OOFEMBinDataReader and is valid only while the reader exists;
+ * clone returns a self-contained text input record.
+ */
+class OOFEM_EXPORT OOFEMBinInputRecord : public InputRecord
+{
+protected:
+    const OOFEMBinDataReader *reader;
+    /// Record index.
+    int irec;
+    /// Index of the first token of record.
+    int first;
+    /// Number of tokens.
+    int ntokens;
+    std :: vector< bool >readFlag;
+    /// Text representation of numeric token (see giveToken).
+    std :: string tokenBuffer;
+
+public:
+    /// Constructor. Creates an empty input record.
+    OOFEMBinInputRecord();
+    /// Sets the record to given record of reader.
+    void setRecord(const OOFEMBinDataReader *reader, int irec);
+
+    std :: unique_ptr< InputRecord >clone() const override;
+    std :: string giveRecordAsString() const override;
+    void finish(bool wrn = true) override;
+
+    void giveRecordKeywordField(std :: string &answer, int &value) override;
+    void giveRecordKeywordField(std :: string &answer) override;
+    void giveField(int &answer, InputFieldType id) override;
+    void giveField(double &answer, InputFieldType id) override;
+    void giveField(bool &answer, InputFieldType id) override;
+    void giveField(std :: string &answer, InputFieldType id) override;
+    void giveField(FloatArray &answer, InputFieldType id) override;
+    void giveField(IntArray &answer, InputFieldType id) override;
+    void giveField(FloatMatrix &answer, InputFieldType id) override;
+    void giveField(std :: vector< std :: string > &answer, InputFieldType id) override;
+    void giveField(Dictionary &answer, InputFieldType id) override;
+    void giveField(std :: list< Range > &answer, InputFieldType id) override;
+    void giveField(ScalarFunction &answer, InputFieldType id) override;
+
+    bool hasField(InputFieldType id) override;
+    void printYourself() override;
+
+protected:
+    /// Returns the index (1-based) of token equal to keyword, zero if not found.
+    int giveKeywordIndx(const char *kwd);
+    /// Returns the text of i-th token (1-based), NULL if out of record.
+    const char *giveToken(int i);
+    /// Reads integer i-th token; returns false if token is missing or not an integer.
+    bool giveInt(int i, int &value) const;
+    /// Reads double i-th token; returns false if token is missing or not a number.
+    bool giveDouble(int i, double &value) const;
+    void setReadFlag(int itok) { readFlag [ itok - 1 ] = true; }
+};
+} // end namespace oofem
+#endif // oofembininputrecord_h
@@ -66,9 +66,12 @@ public:
     virtual ~OOFEMTXTDataReader();
 
     InputRecord &giveInputRecord(InputRecordType, int recordId) override;
+    void giveInputRecords(std :: vector< InputRecord * > &answer, InputRecordType irType, int count) override;
     bool peakNext(const std :: string &keyword) override;
     void finish() override;
     std :: string giveReferenceName() const override { return dataSourceName; }
+    /// Returns all records read from input (used for conversion to other formats).
+    const std :: list< OOFEMTXTInputRecord > &giveRecordList() const { return recordList; }
 
 protected:
     /**
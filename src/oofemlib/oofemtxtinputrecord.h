@@ -101,12 +101,15 @@ public:
     void printYourself() override;
 
     void setLineNumber(int num) { this->lineNumber = num; }
+    int giveLineNumber() const { return this->lineNumber; }
 
-protected:
-    int giveKeywordIndx(const char *kwd);
-    const char *scanInteger(const char *source, int &value);
-    const char *scanDouble(const char *source, double &value);
-    void setReadFlag(int itok) { readFlag [ itok - 1 ] = true; }
+    /**
+     * @name Token parsing helpers.
+     * Shared with other record formats storing the tokens in text form.
+     */
+    //@{
+    static const char *scanInteger(const char *source, int &value);
+    static const char *scanDouble(const char *source, double &value);
 
     /**
      * Reads single range record from input record represented by *helpSource  string.
@@ -116,7 +119,7 @@ protected:
      * @param hi End range index.
      * @return Nonzero on success.
      */
-    int readRange(const char **helpSource, int &li, int &hi);
+    static int readRange(const char **helpSource, int &li, int &hi);
     /**
      * Reads single matrix record from input record represented by *helpSource  string.
      * @param helpSource Pointer to current string position, on return helpSource points
@@ -126,7 +129,12 @@ protected:
      * @param ans Float matrix.
      * @return Nonzero on success.
      */
-    int readMatrix(const char *helpSource, int r, int c, FloatMatrix &ans);
+    static int readMatrix(const char *helpSource, int r, int c, FloatMatrix &ans);
+    //@}
+
+protected:
+    int giveKeywordIndx(const char *kwd);
+    void setReadFlag(int itok) { readFlag [ itok - 1 ] = true; }
 };
 } // end namespace oofem
 #endif // oofemtxtinputrecord_h
@@ -0,0 +1,85 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef parallelfor_h
+#define parallelfor_h
+
+#include <exception>
+
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+
+namespace oofem {
+/**
+ * Evaluates func(i) for i = start, ..., end-1, concurrently if OpenMP is available.
+ * The work done for different i has to be independent. If some evaluations fail,
+ * the error with the lowest index is rethrown after all work is done, so errors are
+ * reported the same way regardless of the number of threads.
+ * @param start First index.
+ * @param end One past last index.
+ * @param func Function to evaluate.
+ * @param minSize Minimum number of indices for which the loop is run in parallel.
+ */
+template< typename F >
+void parallelFor(int start, int end, F func, int minSize = 0)
+{
+#ifdef _OPENMP
+    std :: exception_ptr error;
+    int errorIndex = end;
+ #pragma omp parallel for schedule(dynamic, 64) if ( end - start >= minSize )
+    for ( int i = start; i < end; i++ ) {
+        try {
+            func(i);
+        } catch ( ... ) {
+ #pragma omp critical (oofem_parallelFor)
+            {
+                if ( i < errorIndex ) {
+                    errorIndex = i;
+                    error = std :: current_exception();
+                }
+            }
+        }
+    }
+    if ( error ) {
+        std :: rethrow_exception(error);
+    }
+#else
+    for ( int i = start; i < end; i++ ) {
+        func(i);
+    }
+#endif
+}
+} // end namespace oofem
+#endif // parallelfor_h
@@ -37,7 +37,15 @@
 
 #include "oofemenv.h"
 
+#include <string>
+#include <vector>
+#include <map>
+#include <initializer_list>
+
 namespace oofem {
+class FunctionArgument;
+class CompiledExpression;
+
 #define Parser_CMD_LENGTH 1024
 #define Parser_TBLSZ 23
 
@@ -50,6 +58,8 @@ namespace oofem {
  *
  * Example string:
  * x=3;y=7;sqrt(x*(x/y+3))
+ *
+ * Expressions evaluated repeatedly should be compiled once into CompiledExpression.
  */
 class OOFEM_EXPORT Parser
 {
@@ -66,6 +76,11 @@ public:
     }
 
     double eval(const char *string, int &err);
+    /**
+     * Compiles given expression into postfix code.
+     * The syntax and semantics are the same as for eval, no value is computed.
+     */
+    void compile(const char *string, CompiledExpression &answer);
     void   reset();
 
 private:
@@ -96,6 +111,89 @@ private:
     double prim(bool get);
     double agr(bool get);
     Token_value get_token();
+
+    void cexpr(bool get, CompiledExpression &c);
+    void cterm(bool get, CompiledExpression &c);
+    void cprim(bool get, CompiledExpression &c);
+    void cagr(bool get, CompiledExpression &c);
+};
+
+
+/**
+ * Expression in Parser syntax compiled into postfix code.
+ * Variable names are bound to slots at compile time, so the evaluation needs no parsing,
+ * formatting of the values into strings or name lookup. Evaluation does not modify the receiver
+ * and does not allocate memory (up to LocalBufferSize slots and stack depth), so a single
+ * compiled expression can be shared by functions, loads and boundary conditions and evaluated
+ * from parallel regions.
+ *
+ * Variables read before being assigned within the expression ("free" variables) have to be
+ * supplied by the caller, either as positional arguments declared at compile time or by name
+ * in function argument dictionary. Other variables start from zero, as in Parser.
+ */
+class OOFEM_EXPORT CompiledExpression
+{
+public:
+    /// Number of variables and stack depth evaluated without heap allocation.
+    enum { LocalBufferSize = 32 };
+
+    CompiledExpression() : depth(0), maxDepth(0) { }
+
+    /**
+     * Compiles given expression.
+     * @param expression Expression in Parser syntax.
+     * @param arguments Names of positional arguments of evaluateAt, e.g. {"x", "y", "z", "t"}.
+     */
+    void compile(const std :: string &expression, std :: initializer_list< const char * >arguments = {});
+    /// Returns true if no expression has been compiled.
+    bool isEmpty() const { return code.empty(); }
+    /// Returns number of variable slots.
+    int giveNumberOfVariables() const { return ( int ) names.size(); }
+    /// Returns slot of given variable, -1 if not used by the expression.
+    int giveSlot(const char *name) const;
+
+    /**
+     * Evaluates the expression.
+     * @param vars Values of variables indexed by slot, overwritten by assignments within the expression.
+     */
+    double evaluate(double *vars) const;
+    /// Evaluates the expression for given values of positional arguments.
+    double evaluateAt(std :: initializer_list< double >args) const;
+    /**
+     * Evaluates the expression for arguments given by name. Array arguments define variables
+     * with one based component index appended to the name (x1, x2, ...).
+     */
+    double evaluate(const std :: map< std :: string, FunctionArgument > &valDict) const;
+
+private:
+    enum OpCode {
+        OP_Push, OP_Load, OP_Store, OP_Pop,
+        OP_Add, OP_Sub, OP_Mul, OP_Div, OP_Mod, OP_Pow, OP_Eq, OP_Le, OP_Lt, OP_Ge, OP_Gt, OP_Neg,
+        OP_Sqrt, OP_Sin, OP_Cos, OP_Tan, OP_Atan, OP_Asin, OP_Acos, OP_Exp, OP_Int, OP_Heaviside, OP_Heaviside1
+    };
+    struct Instruction {
+        OpCode op;
+        int slot;
+        double value;
+    };
+
+    /// Postfix code.
+    std :: vector< Instruction >code;
+    /// Variable names by slot.
+    std :: vector< std :: string >names;
+    /// Nonzero if variable is read before it is assigned.
+    std :: vector< char >freeSlot;
+    /// Index of positional argument bound to slot, -1 if none.
+    std :: vector< int >argIndex;
+    /// Splits of variable name into array name and component given by trailing digits (x12 -> x1, 2 and x, 12).
+    std :: vector< std :: vector< std :: pair< std :: string, int > > >components;
+    /// Current and maximal stack depth.
+    int depth, maxDepth;
+
+    void emit(OpCode op, int slot = 0, double value = 0.);
+    int bindSlot(const char *name, bool assign);
+
+    friend class Parser;
 };
 } // end namespace oofem
 #endif // parser_h
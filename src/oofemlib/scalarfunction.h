@@ -65,6 +65,8 @@ class ScalarFunction
     double dValue;
     /// Simple expression (evaluated by internal parser)
     std :: string eValue;
+    /// Compiled simple expression.
+    CompiledExpression eCode;
     /// Reference to external function
     int fReference;
 
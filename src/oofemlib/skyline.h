@@ -75,6 +75,12 @@ protected:
     /// Flag indicating whether factorized.
     int isFactorized;
 
+    /**
+     * Reduces the entries of column k in rows [start, end) by the preceding (already factorized) columns.
+     * The reduced entries are not scaled by the diagonal yet.
+     */
+    void reduceColumn(int k, int start, int end);
+
 public:
     /**
      * Constructor. Before any operation an internal profile must be built.
@@ -103,6 +109,7 @@ public:
 
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
 
     bool canBeFactorized() const override { return true; }
     SparseMtrx *factorized() override;
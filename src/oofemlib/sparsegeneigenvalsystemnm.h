@@ -42,6 +42,7 @@ namespace oofem {
 class EngngModel;
 class SparseMtrx;
 class FloatArray;
+class FloatMatrix;
 
 /**
  * This base class is an abstraction for all numerical methods solving sparse
@@ -75,6 +76,22 @@ public:
      * @return NM_Status value.
      */
     virtual ConvergedReason solve(SparseMtrx &A, SparseMtrx &B, FloatArray &x, FloatMatrix &v, double rtol, int nroot) = 0;
+
+    /**
+     * Restricts the computed eigenvalues to given interval. Solvers supporting shift-invert mode start the
+     * search at the lower bound; other solvers ignore the request.
+     * @param lo Lower bound of eigenvalues.
+     * @param hi Upper bound of eigenvalues.
+     */
+    virtual void setEigenValueRange(double lo, double hi) { }
+    /**
+     * Sets the stopping criterion based on the effective modal mass. The computation terminates (with possibly
+     * less than required number of eigenvalues) once the cumulative effective modal mass reaches given ratio of
+     * the total mass in all directions carrying some mass. Solvers not supporting it ignore the request.
+     * @param influence Influence vectors of unit rigid body motions (one column per direction) in equation numbering.
+     * @param ratio Required ratio of the effective modal mass to the total mass.
+     */
+    virtual void setMassParticipationTarget(const FloatMatrix &influence, double ratio) { }
 };
 } // end namespace oofem
 #endif // sparsegeneigenvalsystemnm_h
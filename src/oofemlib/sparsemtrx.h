@@ -43,6 +43,7 @@
 #include "sparsemtrxtype.h"
 
 #include <memory>
+#include <atomic>
 
 namespace oofem {
 class EngngModel;
@@ -82,8 +83,9 @@ protected:
      * particular matrix; the preconditioner initialization can be demanding
      * and this versioning allows to reuse initialized preconditioner for same
      * matrix, if there is no change;
+     * The counter is atomic, as concurrent assembly (see supportsConcurrentAssembly) may update it from several threads.
      */
-    SparseMtrxVersionType version;
+    std :: atomic< SparseMtrxVersionType > version;
 
 public:
     /**
@@ -91,6 +93,17 @@ public:
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
     SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0) { }
+    /// Copy constructor (the atomic version counter is not copyable by default).
+    SparseMtrx(const SparseMtrx &s) : nRows(s.nRows), nColumns(s.nColumns), tol(s.tol), errorFlag(s.errorFlag), version(s.version.load()) { }
+    /// Assignment operator.
+    SparseMtrx &operator=(const SparseMtrx &s) {
+        nRows = s.nRows;
+        nColumns = s.nColumns;
+        tol = s.tol;
+        errorFlag = s.errorFlag;
+        version = s.version.load();
+        return *this;
+    }
     /// Destructor
     virtual ~SparseMtrx() { }
 
@@ -239,6 +252,12 @@ public:
     virtual int assembleBegin() { return 1; }
     /// Returns when assemble is completed.
     virtual int assembleEnd() { return 1; }
+    /**
+     * Returns true, if assemble can be invoked concurrently from several threads, provided that
+     * the individual contributions do not share any equation (rows and columns).
+     * This is used by colored assembly, where elements of the same color share no dof manager.
+     */
+    virtual bool supportsConcurrentAssembly() const { return false; }
 
     /// Determines, whether receiver can be factorized.
     virtual bool canBeFactorized() const = 0;
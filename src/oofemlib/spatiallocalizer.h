@@ -43,6 +43,7 @@
 
 #include <set>
 #include <list>
+#include <vector>
 
 namespace oofem {
 class Domain;
@@ -176,6 +177,24 @@ public:
      */
     virtual GaussPoint *giveClosestIP(const FloatArray &coords, Set &elemSet, bool iCohesiveZoneGP = false) = 0;
 
+    /**
+     * Batched version of giveElementContainingPoint.
+     * Localizers supporting concurrent queries evaluate the points in parallel.
+     * @param answer Elements containing given points (NULL for points outside of all elements).
+     * @param coords Global coordinates of points of interest.
+     * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
+     */
+    virtual void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords,
+                                              const IntArray *regionList = nullptr);
+    /**
+     * Batched version of giveClosestIP.
+     * Localizers supporting concurrent queries evaluate the points in parallel.
+     * @param answer Closest integration points to given points.
+     * @param coords Global coordinates of points of interest.
+     * @param region Region of elements, all regions are considered for value <= 0.
+     */
+    virtual void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, int region);
+
     /**
      * Returns container (set) of all domain elements having integration point within given box.
      * @param elemSet Answer containing the list of elements meeting the criteria.
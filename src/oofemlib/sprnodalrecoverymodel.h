@@ -82,10 +82,11 @@ public:
     /// Destructor.
     virtual ~SPRNodalRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) override;
-
     const char *giveClassName() const override { return "SPRNodalRecoveryModel"; }
 
+protected:
+    int computeValues(Set &elementSet, InternalStateType type, TimeStep *tStep) override;
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
@@ -105,6 +105,8 @@ public:
      * no communication, therefore it should be measure of workload (in terms of wall clock time) on particular processors.
      * It also typically not include time needed to solve the system of equations, since this has to be done in parallel,
      * so solution takes the same time on all processors and include unwanted synchronization.
+     *
+     * The start-up timers (EMTT_DomainInitTimer and its parts) accumulate over all domains of the problem.
      */
     enum EngngModelTimerType {
         EMTT_AnalysisTimer,
@@ -112,6 +114,10 @@ public:
         EMTT_NetComputationalStepTimer,
         EMTT_LoadBalancingTimer,
         EMTT_DataTransferTimer,
+        EMTT_DomainInitTimer, ///< Whole domain instanciation, including post-initialization.
+        EMTT_DofManagerInitTimer, ///< Creation and initialization of dof managers.
+        EMTT_ElementInitTimer, ///< Creation and initialization of elements.
+        EMTT_PostInitTimer, ///< Post-initialization of domain components (dofs, integration rules).
         EMTT_LastTimer
     };
 
@@ -60,6 +60,12 @@ public:
      * for default numbering to avoid repeated evaluation.
      */
     virtual bool isDefault() const { return false; }
+    /**
+     * Returns the index of the domain location array cache serving this scheme (see ElementLocationCache),
+     * -1 if element location arrays must not be cached. Only schemes that assign the same number to a dof
+     * until the engineering model renumbers equations may be cached.
+     */
+    virtual int giveLocationCacheIndex() const { return -1; }
     /**
      * Returns the equation number for corresponding DOF. The numbering should return nonzero value if
      * the equation is assigned to the given DOF, zero otherwise.
@@ -83,6 +89,7 @@ public:
     EModelDefaultEquationNumbering(void) : UnknownNumberingScheme() { }
 
     bool isDefault() const override { return true; }
+    int giveLocationCacheIndex() const override { return 0; }
     int giveDofEquationNumber(Dof *dof) const override {
         return dof->__giveEquationNumber();
     }
@@ -99,6 +106,7 @@ class OOFEM_EXPORT EModelDefaultPrescribedEquationNumbering : public UnknownNumb
 public:
     EModelDefaultPrescribedEquationNumbering(void) : UnknownNumberingScheme() { }
 
+    int giveLocationCacheIndex() const override { return 1; }
     int giveDofEquationNumber(Dof *dof) const override {
         return dof->__givePrescribedEquationNumber();
     }
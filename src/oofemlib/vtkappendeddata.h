@@ -0,0 +1,137 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef vtkappendeddata_h
+#define vtkappendeddata_h
+
+#include "oofemenv.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+#include <functional>
+
+namespace oofem {
+/// Size of uncompressed blocks of compressed data arrays (same as VTK default).
+#define VTK_APPENDED_BLOCK_SIZE 32768
+/// Zlib compression level of data arrays.
+#define VTK_APPENDED_COMPRESSION_LEVEL 5
+/// Number of characters reserved for the value of DataArray offset attribute.
+#define VTK_APPENDED_OFFSET_WIDTH 20
+
+/**
+ * Appended data section of VTK XML file, written without the VTK library.
+ * DataArray elements refer to binary blocks of the section by offset (format="appended").
+ * The arrays are registered while the XML part is written, together with a function giving their values,
+ * and evaluated one by one when the section is written. Each block is streamed to the file as soon as it
+ * is encoded and the reserved offset attributes are filled in at the end, so the section is never held in memory.
+ * Each block starts with a UInt64 header, the byte count of the data, or for compressed data the number of blocks,
+ * block size, size of the last partial block and compressed sizes of blocks, followed by data compressed by zlib
+ * in blocks of VTK_APPENDED_BLOCK_SIZE bytes (when compiled with __ZLIB_MODULE).
+ * The section is either stored raw or base64 encoded; in the latter case the header of compressed
+ * data is encoded separately from the data, as expected by VTK readers.
+ */
+class OOFEM_EXPORT VTKAppendedData
+{
+public:
+    /// Encoding of appended section.
+    enum Encoding {
+        VTKAE_Raw = 0,     ///< Raw binary data.
+        VTKAE_Base64 = 1,  ///< Base64 encoded data.
+    };
+
+protected:
+    /// Encoding of the section.
+    Encoding encoding;
+    /// Flag indicating zlib compression of arrays.
+    bool compress;
+    /// Functions writing the registered arrays, in order of their DataArray elements.
+    std :: vector< std :: function< void () > >arrays;
+    /// Stream positions of reserved offset attributes.
+    std :: vector< std :: streampos >offsetPositions;
+    /// Stream the section is being written to.
+    std :: ostream *stream;
+    /// Number of characters of the section written so far.
+    std :: size_t size;
+    /// Bytes waiting for base64 encoding.
+    unsigned char pending [ 3 ];
+    /// Number of pending bytes.
+    int npending;
+
+public:
+    /**
+     * Constructor.
+     * @param encoding Encoding of appended section.
+     * @param compress Requests zlib compression, ignored without zlib support.
+     */
+    VTKAppendedData(Encoding encoding, bool compress);
+
+    /**
+     * Registers data array and writes the offset attribute of its DataArray element, with space reserved for the value.
+     * @param xml Stream with the DataArray element, the same stream the section is written to.
+     * @param values Function returning std :: vector of array values. It is called by write,
+     * so everything it refers to has to be kept until then.
+     */
+    template< class F >void addArray(std :: ostream &xml, F values)
+    {
+        this->reserveOffset(xml);
+        arrays.push_back([ this, values ] () {
+            auto v = values();
+            this->writeBlock(v.data(), v.size() * sizeof( v [ 0 ] ) );
+        });
+    }
+
+    /// Returns true if no array has been registered.
+    bool isEmpty() const { return arrays.empty(); }
+    /// Returns attributes of VTKFile element describing the data (byte order, header type, compressor).
+    std :: string giveFileAttributes() const;
+    /**
+     * Writes the AppendedData element, evaluating and streaming registered arrays one by one,
+     * and fills in the offset attributes. The stream is left positioned at its end.
+     */
+    void write(std :: ostream &stream);
+
+protected:
+    /// Writes offset attribute placeholder.
+    void reserveOffset(std :: ostream &xml);
+    /// Writes block of one array (header and data) to the stream.
+    void writeBlock(const void *bytes, std :: size_t nbytes);
+    /// Writes given bytes to the stream, encoded if required.
+    void encode(const unsigned char *bytes, std :: size_t nbytes);
+    /// Terminates encoded sequence, padding pending bytes.
+    void flush();
+};
+} // end namespace oofem
+#endif // vtkappendeddata_h
@@ -113,6 +113,11 @@ protected:
      * Export internal variables by smoothing.
      */
     virtual void exportIntVars(ExportRegion &piece, Set& region, IntArray& internalVarsToExport, NodalRecoveryModel& smoother, TimeStep *tStep);
+    /**
+     * Recovers all smoothed internal variables of the region in one pass over its elements.
+     * The values are shared with other export modules through the domain recovery cache.
+     */
+    void recoverIntVars(Set& region, const IntArray& internalVarsToExport, NodalRecoveryModel& smoother, TimeStep *tStep);
     /**
      * Export external forces.
      */
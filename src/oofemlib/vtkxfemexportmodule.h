@@ -86,6 +86,8 @@ public:
 
     void initializeFrom(InputRecord &ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+    /// Output is written at once by doOutput.
+    std::function< void() >captureOutput(TimeStep *tStep, bool forcedOutput = false) override { return ExportModule::captureOutput(tStep, forcedOutput); }
     void terminate() override {}
     const char *giveClassName() const override { return "VTKXMLXFemExportModule"; }
 
@@ -67,6 +67,8 @@ namespace py = pybind11;
 
 #include <string>
 #include <list>
+#include <memory>
+#include <functional>
 
 ///@name Input fields for VTK XML export module
 //@{
@@ -77,11 +79,21 @@ namespace py = pybind11;
 #define _IFT_VTKXMLExportModule_externalForces "externalforces"
 #define _IFT_VTKXMLExportModule_ipvars "ipvars"
 #define _IFT_VTKXMLExportModule_stype "stype"
+#define _IFT_VTKXMLExportModule_format "format"
+#define _IFT_VTKXMLExportModule_compress "compress"
 //@}
 
 using namespace std;
 namespace oofem {
 class Node;
+class VTKAppendedData;
+
+/// Format of data arrays in vtu files.
+enum VTKXMLDataFormat {
+    VTKXML_Ascii = 0,           ///< Formatted ascii values (default).
+    VTKXML_AppendedRaw = 1,     ///< Appended raw binary data.
+    VTKXML_AppendedBase64 = 2,  ///< Appended base64 encoded binary data.
+};
 
 /**
  * Represents VTK (Visualization Toolkit) export module. It uses VTK (.vtu) file format, Unstructured grid dataset.
@@ -108,6 +120,10 @@ protected:
 
     /// Smoother type.
     NodalRecoveryModel::NodalRecoveryModelType stype;
+    /// Format of data arrays.
+    VTKXMLDataFormat dataFormat;
+    /// Flag requesting zlib compression of binary data arrays.
+    bool compressData;
     /// Smoother.
     std::unique_ptr< NodalRecoveryModel >smoother;
     /// Smoother for primary variables.
@@ -128,6 +144,7 @@ public:
 
     void initializeFrom(InputRecord &ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+    std::function< void() >captureOutput(TimeStep *tStep, bool forcedOutput = false) override;
     void initialize() override;
     void terminate() override;
     const char *giveClassName() const override { return "VTKXMLExportModule"; }
@@ -159,12 +176,54 @@ public:
     
     ExportRegion& getExportRegions() {return this->defaultVTKPiece;}
 protected:
+    /**
+     * Output of one solution step captured by captureOutput. Contains everything needed
+     * to write the vtu file and update the pvd collection without the domain.
+     */
+    struct Snapshot {
+        /// Name of the vtu file.
+        std::string fileName;
+        /// Header comment with time step and time of capture.
+        std::string header;
+        /// Exported pieces, default pieces of regions followed by composite elements.
+        std::vector< ExportRegion >pieces;
+        /// Entries appended to the pvd collection.
+        std::vector< std::string >pvdEntries;
+        /// Whether the pvd collection file is rewritten.
+        bool writeCollection = false;
+        /// Name of the pvtu file collecting pieces of all processes, empty if not written.
+        std::string pvtuFileName;
+        /// Piece files of all processes referenced from the pvtu file.
+        std::vector< std::string >pvtuSources;
+        /// Number of components of exported internal variables, filled before the pieces are written out.
+        IntArray internalVarSizes;
+    };
+
+    /// Writes the captured step to vtu file and updates the collection.
+    void writeSnapshot(Snapshot &snapshot);
+#ifndef __VTK_MODULE
+    /**
+     * Writes piece header, geometry and variables referring to binary data arrays appended to given section.
+     * @return true if piece is not empty and thus written
+     */
+    bool writeVTKPieceAppended(ExportRegion &vtkPiece, VTKAppendedData &appended);
+#endif
+    /// Writes the pvtu file referencing the vtu files written by all processes.
+    void writePVTUFile(const Snapshot &snapshot);
+    /**
+     * Returns the number of components of internal variable written for given piece.
+     * Taken from the value in the first node, as it may differ from the size of the value type
+     * (e.g. IST_BeamForceMomentTensor).
+     */
+    int giveInternalVarSize(ExportRegion &vtkPiece, InternalStateType type);
 
     /// Returns the filename for the given time step.
     std::string giveOutputFileName(TimeStep *tStep);
 
     /// Returns the output stream for given solution step.
     std::ofstream giveOutputStream(TimeStep *tStep);
+    /// Returns the output stream for given file name.
+    std::ofstream giveOutputStream(const std::string &fileName);
 
     void writeIntVars(ExportRegion &vtkPiece);
     void writeXFEMVars(ExportRegion &vtkPiece);
@@ -87,6 +87,8 @@ public:
     std::ofstream giveOutputStreamCross(TimeStep *tStep);
 
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+    /// Output is written at once by doOutput.
+    std::function< void() >captureOutput(TimeStep *tStep, bool forcedOutput = false) override { return ExportModule::captureOutput(tStep, forcedOutput); }
 
     void doOutputNormal(TimeStep *tStep, bool forcedOutput = false);
 
@@ -72,10 +72,11 @@ public:
     /// Destructor.
     virtual ~ZZNodalRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) override;
-
     const char *giveClassName() const override { return "ZZNodalRecoveryModel"; }
 
+protected:
+    int computeValues(Set &elementSet, InternalStateType type, TimeStep *tStep) override;
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
@@ -49,6 +49,7 @@
 #define _IFT_EigenValueDynamic_nroot "nroot"
 #define _IFT_EigenValueDynamic_rtolv "rtolv"
 #define _IFT_EigenValueDynamic_stype "stype"
+#define _IFT_EigenValueDynamic_freqRange "freqrange"
 //@}
 
 namespace oofem {
@@ -80,6 +81,8 @@ private:
     int numberOfRequiredEigenValues;
     /// Relative tolerance.
     double rtolv;
+    /// Range of frequencies of required modes (shift-invert mode of solver), empty if not used.
+    FloatArray freqRange;
     std :: unique_ptr< SparseGeneralEigenValueSystemNM > nMethod;
     GenEigvalSolverType solverType;
 
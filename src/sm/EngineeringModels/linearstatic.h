@@ -39,8 +39,10 @@
 #include "sparselinsystemnm.h"
 #include "sparsemtrxtype.h"
 #include "unknownnumberingscheme.h"
+#include "floatmatrix.h"
 
 #define _IFT_LinearStatic_Name "linearstatic"
+#define _IFT_LinearStatic_blockSize "blocksize"
 
 namespace oofem {
 class SparseMtrx;
@@ -59,6 +61,11 @@ class SparseMtrx;
  * - Creating Numerical method for solving @f$ K\cdot x=b @f$.
  * - Interfacing Numerical method to Elements.
  * - Managing time steps.
+ *
+ * In block mode (blocksize > 1), the load vectors of several subsequent load cases (within the same metastep)
+ * are assembled at once into a right hand side matrix and solved together with single factorization of the stiffness
+ * matrix. The load vectors and solutions are stored and the individual time steps then only pick up their columns
+ * and proceed with the standard update and output.
  */
 class LinearStatic : public StructuralEngngModel
 {
@@ -75,6 +82,38 @@ protected:
     int initFlag;
     EModelDefaultEquationNumbering equationNumbering;
 
+    /// Maximum number of load cases solved together in block mode (block mode is off if less than 2).
+    int blockSize;
+    /// Load vectors of the current block of load cases, one column per time step.
+    FloatMatrix blockLoads;
+    /// Solutions of the current block of load cases, one column per time step.
+    FloatMatrix blockSolution;
+    /**
+     * Time steps of the current block following its first step, identical to those generated later by giveNextStep.
+     * They exist only while their load vectors are assembled, their unknowns are zero then.
+     */
+    std :: vector< std :: unique_ptr< TimeStep > >blockSteps;
+    /// Number of the time step corresponding to the first column of blockSolution.
+    int blockFirstStep;
+
+    /**
+     * Assembles the load vector (external forces minus internal forces due to prescribed values, temperature etc.).
+     * @param answer Load vector.
+     * @param tStep Time step, which has to be the current step of the receiver.
+     */
+    void assembleLoadVector(FloatArray &answer, TimeStep *tStep);
+    /**
+     * Solves the block of load cases starting at given time step.
+     * @param tStep First time step of the block.
+     * @return Status of the linear solver.
+     */
+    ConvergedReason solveBlock(TimeStep *tStep);
+    /**
+     * Returns number of the last time step, which may be solved in the same block as given step.
+     * Default implementation returns last step of the corresponding metastep.
+     */
+    virtual int giveLastBlockStep(TimeStep *tStep);
+
 public:
     LinearStatic(int i, EngngModel *master = nullptr);
     virtual ~LinearStatic();
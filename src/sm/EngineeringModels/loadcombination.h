@@ -0,0 +1,156 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef loadcombination_h
+#define loadcombination_h
+
+#include "sm/EngineeringModels/linearstatic.h"
+#include "floatmatrix.h"
+#include "floatarray.h"
+#include "intarray.h"
+#include "timestep.h"
+
+///@name Input fields for LoadCombination
+//@{
+#define _IFT_LoadCombination_Name "loadcombination"
+#define _IFT_LoadCombination_factors "factors"
+#define _IFT_LoadCombination_envelope "envelope"
+//@}
+
+namespace oofem {
+/**
+ * This class implements linear static analysis of primary load cases followed by evaluation of load combinations
+ * by superposition.
+ * The first nsteps time steps are the primary load cases, solved in the same way as in LinearStatic (including the
+ * optional block mode). After each load case, the displacements, prescribed values, reactions and beam end
+ * displacements and forces are stored column-wise. Each following time step corresponds to one row of the
+ * combination factor matrix and its results are obtained as a linear combination of stored load cases, without
+ * assembling, solving or evaluating any element. All combinations are evaluated at once (one matrix product per
+ * stored quantity) and kept, so optional two more steps with the envelope (maximum and minimum of each component
+ * over all combinations) only reduce the stored combinations.
+ *
+ * Combination steps are printed from the stored results (only beam elements are reported in element output,
+ * as no integration point state is recomputed) and can be post-processed by BeamExportModule. Export modules
+ * querying element internal state see the state of the last load case.
+ */
+class LoadCombination : public LinearStatic
+{
+protected:
+    /// Number of primary load cases.
+    int nLoadCases;
+    /// Combination factors, column k contains factors of individual load cases of k-th combination.
+    FloatMatrix factors;
+    /// Flag indicating that the envelopes of all combinations are evaluated.
+    bool envelopeFlag;
+
+    /// Displacements of load cases, one column per load case.
+    FloatMatrix caseDisplacements;
+    /// Prescribed values of load cases, rows follow prescribed equation numbering.
+    FloatMatrix casePrescribed;
+    /// Reactions of load cases, rows follow prescribed equation numbering.
+    FloatMatrix caseReactions;
+    /// Local end displacements followed by end forces of beam elements, for each load case.
+    FloatMatrix caseBeamResults;
+    /**
+     * Offsets of beam element values in caseBeamResults; local end displacements of element i occupy rows
+     * beamOffsets(2i-1)+1 to beamOffsets(2i), end forces rows beamOffsets(2i)+1 to beamOffsets(2i+1).
+     */
+    IntArray beamOffsets;
+
+    /// Displacements of all combinations, one column per combination; empty until the first combination step.
+    FloatMatrix combDisplacements;
+    /// Prescribed values of all combinations.
+    FloatMatrix combPrescribed;
+    /// Reactions of all combinations.
+    FloatMatrix combReactions;
+    /// Beam end values of all combinations.
+    FloatMatrix combBeamResults;
+
+    /// Prescribed values of current combination.
+    FloatArray combinedPrescribed;
+    /// Reactions of current combination.
+    FloatArray combinedReactions;
+    /// Beam end values of current combination.
+    FloatArray combinedBeamResults;
+
+    /// Stores results of given load case.
+    void storeLoadCaseResults(TimeStep *tStep);
+    void printOutputAt(FILE *file, TimeStep *tStep) override;
+    int giveLastBlockStep(TimeStep *tStep) override { return nLoadCases; }
+
+public:
+    LoadCombination(int i, EngngModel *master = nullptr);
+    virtual ~LoadCombination() { }
+
+    void initializeFrom(InputRecord &ir) override;
+    void solveYourselfAt(TimeStep *tStep) override;
+    void updateYourself(TimeStep *tStep) override;
+    void printDofOutputAt(FILE *stream, Dof *iDof, TimeStep *tStep) override;
+    void computeReaction(FloatArray &answer, TimeStep *tStep, int di) override;
+
+    void saveContext(DataStream &stream, ContextMode mode) override;
+    void restoreContext(DataStream &stream, ContextMode mode) override;
+
+    /// Returns number of primary load cases.
+    int giveNumberOfLoadCases() const { return nLoadCases; }
+    /// Returns true if given time step is primary load case.
+    bool isLoadCaseStep(TimeStep *tStep);
+    /// Returns number of the load case corresponding to given load case time step.
+    int giveLoadCaseNumber(TimeStep *tStep) { return tStep->giveNumber() - this->giveNumberOfFirstStep() + 1; }
+    /**
+     * Returns number of the combination corresponding to given time step, zero for load case steps.
+     * Steps with the maximum and minimum envelope have numbers equal to number of combinations plus one and plus two.
+     */
+    int giveCombinationNumber(TimeStep *tStep);
+    /**
+     * Evaluates all combinations.
+     * @param answer Combined values, one column per combination.
+     * @param caseValues Values of primary load cases, one column per load case.
+     */
+    void combineLoadCases(FloatMatrix &answer, const FloatMatrix &caseValues) { answer.beProductOf(caseValues, factors); }
+    /**
+     * Gives the combination (or envelope) corresponding to given time step.
+     * @param answer Combined values.
+     * @param combinedValues Values of all combinations, as given by combineLoadCases.
+     * @param tStep Combination time step.
+     */
+    void giveCombinedValues(FloatArray &answer, const FloatMatrix &combinedValues, TimeStep *tStep);
+
+    // identification
+    const char *giveInputRecordName() const override { return _IFT_LoadCombination_Name; }
+    const char *giveClassName() const override { return "LoadCombination"; }
+};
+} // end namespace oofem
+#endif // loadcombination_h
@@ -41,6 +41,8 @@
 
 #define _IFT_PDeltaStatic_Name "PDeltaStatic"
 #define _IFT_PDeltaStatic_rtolv "rtolv"
+#define _IFT_PDeltaStatic_preconditioned "preconditioned"
+#define _IFT_PDeltaStatic_maxiter "maxiter"
 
 namespace oofem {
 class SparseMtrx;
@@ -59,12 +61,20 @@ class SparseMtrx;
  * - Creating Numerical method for solving @f$ K\cdot x=b @f$.
  * - Interfacing Numerical method to Elements.
  * - Managing time steps.
+ *
+ * The P-delta effect is resolved iteratively. By default, the sum of elastic and initial stress matrices is kept
+ * allocated on the pattern of the elastic stiffness and refilled in place in every iteration, so that the linear
+ * solver can reuse its symbolic factorization. In preconditioned mode, the initial stress contribution is moved
+ * to the right hand side and the iterations are driven by the factorized elastic stiffness only. This stationary
+ * iteration converges only when the initial stress effect is small compared to the elastic stiffness (i.e. well
+ * below the critical load); a warning is issued when the tolerance is not reached within the allowed iterations.
  */
 class PDeltaStatic : public StructuralEngngModel
 {
 protected:
     std :: unique_ptr< SparseMtrx > stiffnessMatrix;
-	std :: unique_ptr< SparseMtrx > initialStressMatrix;
+	/// Sum of elastic and initial stress matrices, sharing the pattern of stiffnessMatrix.
+	std :: unique_ptr< SparseMtrx > Kiter;
     FloatArray loadVector;
     FloatArray displacementVector;
 
@@ -73,6 +83,10 @@ protected:
     /// Numerical method used to solve the problem.
     std :: unique_ptr< SparseLinearSystemNM > nMethod;
 	double rtolv;
+	/// Maximum number of P-delta iterations.
+	int maxIter;
+	/// Flag indicating that iterations use the elastic stiffness only (with initial stress forces on the right hand side).
+	bool preconditionedFlag;
     int initFlag;
 	void updateAfterStatic(TimeStep *tStep, Domain *domain);
 
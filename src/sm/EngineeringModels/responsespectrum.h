@@ -58,6 +58,8 @@
 #define _IFT_ResponseSpectrum_dir "dir"
 #define _IFT_ResponseSpectrum_modalCombo "modalcombo"
 #define _IFT_ResponseSpectrum_damp "damp"
+#define _IFT_ResponseSpectrum_freqRange "freqrange"
+#define _IFT_ResponseSpectrum_massParticipation "massparticipation"
 //@}
 
 namespace oofem {
@@ -72,6 +74,9 @@ enum RSpecComboType {
  * Base for this class is EigenValueDynamic class, functionality
  * of which has been extended.
  *
+ * Export modules are called for every mode with the time step number set to the mode number, then once more
+ * for the combined results with version 1 of the first time step (so that both can be checked separately).
+ *
  * @author Francesco Pontarin
  */
 class ResponseSpectrum : public EngngModel
@@ -95,6 +100,10 @@ private:
     int restoreFlag;
     /// Relative tolerance.
     double rtolv;
+    /// Range of frequencies of required modes (shift-invert mode of solver), empty if not used.
+    FloatArray freqRange;
+    /// Required ratio of effective modal mass, zero if not used.
+    double massParticipation = 0.;
     /// Numerical method used to solve the problem.
     std ::unique_ptr<SparseGeneralEigenValueSystemNM> nMethod;
     GenEigvalSolverType solverType;
@@ -106,15 +115,18 @@ private:
     FloatArray dir;
     // internal variables
     FloatArray loadVector;
-    std::list<FloatArray> reactionsList;
-    std::list<FloatArray> dispList;
+    /// Modal displacements, reactions and element responses, one (contiguous) column per mode.
+    FloatMatrix modalDisps, modalReactions, modalResponses;
+    /**
+     * Offsets of element responses in rows of modalResponses, responses of element i occupy
+     * rows responseOffsets(i) + 1 ... responseOffsets(i + 1).
+     */
+    IntArray responseOffsets;
     FloatArray combReactions;
     FloatArray combDisps;
+    /// Combined element responses, with the layout given by responseOffsets.
+    FloatArray combResponses;
     IntArray dofManMap, dofidMap, eqnMap;
-    std::list<std::map<int, std::map<int, std::map<int, std::map<std::string, FloatArray> > > > > elemResponseList;
-    std::list<std::map<int, std::map<std::string, FloatArray> > > beamResponseList;
-    std::map<int, std::map<int, std::map<int, std::map<std::string, FloatArray> > > > combElemResponse;
-    std::map<int, std::map<std::string, FloatArray> > combBeamResponse;
 
 
 public:
@@ -143,9 +155,19 @@ public:
 
     void postInitialize() override;
 
-    void getGPOutputAt( GaussPoint *gp, TimeStep *tStep, std::map<std::string, FloatArray> *&ips );
-    void getIntRuleOutputAt( IntegrationRule *iRule, TimeStep *tStep, std::map<int, std::map<std::string, FloatArray> > *&ir );
-    void getIntPointStatusOutputAt( IntegrationPointStatus *iStatus, TimeStep *tStep, MaterialMode materialMode, std::map<std::string, FloatArray> *&ir );
+    /**
+     * Appends the responses of given element to answer: local end displacements and forces for beams,
+     * followed by strains and stresses in all integration points.
+     */
+    void giveElementResponses( FloatArray &answer, Element *elem, TimeStep *tStep );
+    /**
+     * Combines modal responses (one column per mode). Each row is combined as
+     * @f$ \sqrt{\sum_i \sum_j |r_i| \rho_{ij} |r_j|} @f$, evaluated as a single matrix product.
+     * @param answer Combined responses.
+     * @param modal Modal responses.
+     * @param coeffs Correlation coefficients, NULL for SRSS rule (identity).
+     */
+    void combineModalResponses( FloatArray &answer, const FloatMatrix &modal, const FloatMatrix *coeffs );
     double calcSpectrumOrdinate( double period );
     void computeExternalLoadReactionContribution( FloatArray &reactions, TimeStep *tStep, int di );
     void buildReactionTable( IntArray &restrDofMans, IntArray &restrDofs,
@@ -156,6 +178,8 @@ public:
     void CQC();
     void giveRhos( FloatMatrix &rhos );
     void giveDominantMode( int &mode );
+    /// Computes influence vectors of unit translations in global directions (columns) in default equation numbering.
+    void computeInfluenceVectors( FloatMatrix &answer );
     RSpecComboType giveComboType();
 
     // identification
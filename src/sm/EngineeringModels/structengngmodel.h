@@ -147,7 +147,7 @@ public:
      * @param tStep Time step.
      * @param di Domain number.
      */
-    void computeReaction(FloatArray &answer, TimeStep *tStep, int di);
+    virtual void computeReaction(FloatArray &answer, TimeStep *tStep, int di);
 
     /**
      * Terminates the solution of time step. Default implementation calls prinOutput() service and if specified,
@@ -55,16 +55,16 @@ namespace oofem {
  * The load time function is not used here, the function provided is
  * supposed to be function of time and coordinates.
  *
- * Uses Parser class to parse given expression. Slow but useful.
+ * The expressions are compiled once, with "x", "y", "z" and "t" as arguments.
  * Temperature load as body load is typically attribute of  domain and is
  * attribute of one or more elements.
  */
 class UserDefinedTemperatureField : public StructuralTemperatureLoad
 {
 private:
-    Parser myParser;
     int size;
     std :: string ftExpression [ 3 ];
+    CompiledExpression ftCode [ 3 ];
 
 public:
     /**
@@ -72,7 +72,7 @@ public:
      * @param n Load time function number
      * @param d Domain to which new object will belongs.
      */
-    UserDefinedTemperatureField(int n, Domain * d) : StructuralTemperatureLoad(n, d), myParser() { }
+    UserDefinedTemperatureField(int n, Domain * d) : StructuralTemperatureLoad(n, d) { }
     /// Destructor
     virtual ~UserDefinedTemperatureField() { }
 
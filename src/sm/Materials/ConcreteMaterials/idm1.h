@@ -123,7 +123,7 @@ class IsotropicDamageMaterial1Status : public IsotropicDamageMaterialStatus, pub
 {
 public:
     /// Constructor
-    IsotropicDamageMaterial1Status(GaussPoint *g);
+    IsotropicDamageMaterial1Status(GaussPoint *g, MaterialStatusStore *store = NULL);
 
     const char *giveClassName() const override { return "IsotropicDamageMaterial1Status"; }
 
@@ -121,7 +121,7 @@ protected:
 class IsotropicGradientDamageMaterialStatus : public IsotropicDamageMaterial1Status, public GradientDamageMaterialStatusExtensionInterface
 {
 public:
-    IsotropicGradientDamageMaterialStatus(GaussPoint *g);
+    IsotropicGradientDamageMaterialStatus(GaussPoint *g, MaterialStatusStore *store = NULL);
 
     const char *giveClassName() const override { return "IsotropicGradientDamageMaterialStatus"; }
 
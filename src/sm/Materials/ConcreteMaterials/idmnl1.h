@@ -66,7 +66,7 @@ protected:
 
 public:
     /// Constructor.
-    IDNLMaterialStatus(GaussPoint *g);
+    IDNLMaterialStatus(GaussPoint *g, MaterialStatusStore *store = NULL);
 
     void printOutputAt(FILE *file, TimeStep *tStep) const override;
 
@@ -146,6 +146,9 @@ public:
     { return IsotropicDamageMaterial1 :: computeEquivalentStrain(strain, gp, tStep); }
 
     void updateBeforeNonlocAverage(const FloatArray &strainVector, GaussPoint *gp, TimeStep *tStep) const override;
+    double giveLocalValueForAverage(GaussPoint *gp) const override;
+    /// Interaction table is used unless the weights are modified by stress or damage.
+    bool hasInteractionTable() const override;
 
     /// Compute the factor that specifies how the interaction length should be modified (by eikonal nonlocal damage models)
     double giveNonlocalMetricModifierAt(GaussPoint *gp) const override;
@@ -169,6 +172,7 @@ public:
      * receiver's associated integration point.
      */
     std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
+    void NonlocalMaterialStiffnessInterface_giveInfluencingPoints(std :: vector< GaussPoint * > &answer, GaussPoint *gp) override;
     /**
      * Computes the "local" part of nonlocal stiffness contribution assembled for given integration point.
      * @param gp Source integration point.
@@ -208,7 +212,8 @@ public:
     double predictRelativeComputationalCost(GaussPoint *gp) override;
     double predictRelativeRedistributionCost(GaussPoint *gp) override { return 1.0; }
 
-    MaterialStatus *CreateStatus(GaussPoint *gp) const override { return new IDNLMaterialStatus(gp); }
+    MaterialStatus *CreateStatus(GaussPoint *gp) const override
+    { return new IDNLMaterialStatus( gp, this->giveStatusStore(IsotropicDamageMaterialStatus :: IDMS_NumberOfVariables) ); }
 
 protected:
     void initDamaged(double kappa, FloatArray &totalStrainVector, GaussPoint *gp) const override { }
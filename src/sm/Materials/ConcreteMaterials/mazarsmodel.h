@@ -67,7 +67,7 @@ protected:
 
 public:
     /// Constructor.
-    MazarsMaterialStatus(GaussPoint * g);
+    MazarsMaterialStatus(GaussPoint * g, MaterialStatusStore * store = NULL);
 
     /// Returns characteristic length stored in receiver.
     double giveLec() { return lec; }
@@ -116,7 +116,8 @@ public:
     double computeEquivalentStrain(const FloatArray &strain, GaussPoint *gp, TimeStep *tStep) const override;
     double computeDamageParam(double kappa, const FloatArray &strain, GaussPoint *gp) const override;
 
-    MaterialStatus *CreateStatus(GaussPoint *gp) const override { return new MazarsMaterialStatus(gp); }
+    MaterialStatus *CreateStatus(GaussPoint *gp) const override
+    { return new MazarsMaterialStatus( gp, this->giveStatusStore(IsotropicDamageMaterialStatus :: IDMS_NumberOfVariables) ); }
 
 protected:
     /**
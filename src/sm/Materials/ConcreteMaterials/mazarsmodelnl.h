@@ -58,7 +58,7 @@ protected:
 
 public:
     /// Constructor
-    MazarsNLMaterialStatus(GaussPoint * g);
+    MazarsNLMaterialStatus(GaussPoint * g, MaterialStatusStore * store = NULL);
 
     void printOutputAt(FILE *file, TimeStep *tStep) const override;
 
@@ -121,8 +121,10 @@ public:
     { return MazarsMaterial :: computeEquivalentStrain(strain, gp, tStep); }
 
     void updateBeforeNonlocAverage(const FloatArray &strainVector, GaussPoint *gp, TimeStep *tStep) const override;
+    double giveLocalValueForAverage(GaussPoint *gp) const override;
   double computeWeightFunction(const double cl, const FloatArray &src, const FloatArray &coord) const override;
     int hasBoundedSupport() const override { return 1; }
+    bool hasInteractionTable() const override { return this->permanentNonlocTableFlag && this->hasBoundedSupport(); }
     /**
      * Determines the width (radius) of limited support of weighting function
      */
@@ -132,7 +134,8 @@ public:
     int unpackAndUpdateUnknowns(DataStream &buff, TimeStep *tStep, GaussPoint *ip) override;
     int estimatePackSize(DataStream &buff, GaussPoint *ip) override;
 
-    MaterialStatus *CreateStatus(GaussPoint *gp) const override { return new MazarsNLMaterialStatus(gp); }
+    MaterialStatus *CreateStatus(GaussPoint *gp) const override
+    { return new MazarsNLMaterialStatus( gp, this->giveStatusStore(IsotropicDamageMaterialStatus :: IDMS_NumberOfVariables) ); }
 
 protected:
     void initDamaged(double kappa, FloatArray &totalStrainVector, GaussPoint *gp) const override;
@@ -61,15 +61,21 @@ class GaussPoint;
  */
 class IsotropicDamageMaterialStatus : public StructuralMaterialStatus
 {
+public:
+    /// Indices of history variables in the status slot.
+    enum {
+        IDMS_Kappa, ///< Scalar measure of the largest strain level ever reached in material.
+        IDMS_Damage, ///< Damage level of material.
+#ifdef keep_track_of_dissipated_energy
+        IDMS_StressWork, ///< Density of total work done by stresses on strain increments.
+        IDMS_DissWork, ///< Density of dissipated work.
+#endif
+        IDMS_NumberOfVariables
+    };
+
 protected:
-    /// Scalar measure of the largest strain level ever reached in material.
-    double kappa = 0.;
-    /// Non-equilibrated scalar measure of the largest strain level.
-    double tempKappa = 0.;
-    /// Damage level of material.
-    double damage = 0.;
-    /// Non-equilibrated damage level of material.
-    double tempDamage = 0.;
+    /// Equilibrated and non-equilibrated history variables.
+    MaterialStatusSlot history;
     /**
      * Characteristic element length,
      * computed when damage initialized from direction of
@@ -81,35 +87,28 @@ protected:
     /// Crack orientation normalized to damage magnitude. This is useful for plotting cracks as a vector field (paraview etc.).
     FloatArrayF<3> crackVector;
 
-#ifdef keep_track_of_dissipated_energy
-    /// Density of total work done by stresses on strain increments.
-    double stressWork = 0.;
-    /// Non-equilibrated density of total work done by stresses on strain increments.
-    double tempStressWork = 0.;
-    /// Density of dissipated work.
-    double dissWork = 0.;
-    /// Non-equilibrated density of dissipated work.
-    double tempDissWork = 0.;
-#endif
-
 public:
-    /// Constructor
-    IsotropicDamageMaterialStatus(GaussPoint *g);
+    /**
+     * Constructor.
+     * @param g Integration point.
+     * @param store Store of history variables of the material, own storage is used if NULL.
+     */
+    IsotropicDamageMaterialStatus(GaussPoint *g, MaterialStatusStore *store = NULL);
 
     void printOutputAt(FILE *file, TimeStep *tStep) const override;
 
     /// Returns the last equilibrated scalar measure of the largest strain level.
-    double giveKappa() const { return kappa; }
+    double giveKappa() const { return history.give(IDMS_Kappa); }
     /// Returns the temp. scalar measure of the largest strain level.
-    double giveTempKappa() const { return tempKappa; }
+    double giveTempKappa() const { return history.giveTemp(IDMS_Kappa); }
     /// Sets the temp scalar measure of the largest strain level to given value.
-    void setTempKappa(double newKappa) { tempKappa = newKappa; }
+    void setTempKappa(double newKappa) { history.setTemp(IDMS_Kappa, newKappa); }
     /// Returns the last equilibrated damage level.
-    double giveDamage() const { return damage; }
+    double giveDamage() const { return history.give(IDMS_Damage); }
     /// Returns the temp. damage level.
-    double giveTempDamage() const { return tempDamage; }
+    double giveTempDamage() const { return history.giveTemp(IDMS_Damage); }
     /// Sets the temp damage level to given value.
-    void setTempDamage(double newDamage) { tempDamage = newDamage; }
+    void setTempDamage(double newDamage) { history.setTemp(IDMS_Damage, newDamage); }
 
     /// Returns characteristic length stored in receiver.
     double giveLe() const { return le; }
@@ -120,23 +119,23 @@ public:
     /// Sets crack angle to given value.
     void setCrackAngle(double ca) { crack_angle = ca; }
     /// Returns crack vector stored in receiver. This is useful for plotting cracks as a vector field (paraview etc.).
-    FloatArrayF<3> giveCrackVector() const { return crackVector * damage; }
+    FloatArrayF<3> giveCrackVector() const { return crackVector * this->giveDamage(); }
     /// Sets crack vector to given value. This is useful for plotting cracks as a vector field (paraview etc.).
     void setCrackVector(const FloatArrayF<3> &cv) { crackVector = cv; }
 
 #ifdef keep_track_of_dissipated_energy
     /// Returns the density of total work of stress on strain increments.
-    double giveStressWork() const { return stressWork; }
+    double giveStressWork() const { return history.give(IDMS_StressWork); }
     /// Returns the temp density of total work of stress on strain increments.
-    double giveTempStressWork() const { return tempStressWork; }
+    double giveTempStressWork() const { return history.giveTemp(IDMS_StressWork); }
     /// Sets the density of total work of stress on strain increments to given value.
-    void setTempStressWork(double w) { tempStressWork = w; }
+    void setTempStressWork(double w) { history.setTemp(IDMS_StressWork, w); }
     /// Returns the density of dissipated work.
-    double giveDissWork() const { return dissWork; }
+    double giveDissWork() const { return history.give(IDMS_DissWork); }
     /// Returns the density of temp dissipated work.
-    double giveTempDissWork() const { return tempDissWork; }
+    double giveTempDissWork() const { return history.giveTemp(IDMS_DissWork); }
     /// Sets the density of dissipated work to given value.
-    void setTempDissWork(double w) { tempDissWork = w; }
+    void setTempDissWork(double w) { history.setTemp(IDMS_DissWork, w); }
     /// Computes the increment of total stress work and of dissipated work.
     void computeWork(GaussPoint *gp);
 #endif
@@ -268,7 +267,8 @@ public:
     void initializeFrom(InputRecord &ir) override;
     void giveInputRecord(DynamicInputRecord &input) override;
 
-    MaterialStatus *CreateStatus(GaussPoint *gp) const override { return new IsotropicDamageMaterialStatus(gp); }
+    MaterialStatus *CreateStatus(GaussPoint *gp) const override
+    { return new IsotropicDamageMaterialStatus( gp, this->giveStatusStore(IsotropicDamageMaterialStatus :: IDMS_NumberOfVariables) ); }
 
     FloatMatrixF<1,1> give1dStressStiffMtrx(MatResponseMode mmode, GaussPoint *gp,
                                             TimeStep *tStep) const override;
@@ -38,6 +38,7 @@
 #include "exportmodule.h"
 #include "floatarray.h"
 #include "../sm/EngineeringModels/responsespectrum.h"
+#include "../sm/EngineeringModels/loadcombination.h"
 #include <map>
 #include <math.h>
 #include <cstring>
@@ -73,6 +74,31 @@ protected:
     RSpecComboType modalCombo;
     double csi;
     ResponseSpectrum *rs;
+    /// Load combination model, results of combinations are superposed from stored results of load cases.
+    LoadCombination *lc = nullptr;
+    /// Stored results of load cases, one column per load case.
+    FloatMatrix caseValues;
+    /// Station values of all load combinations, one column per combination.
+    FloatMatrix combinedValues;
+    /// Stored results of modes (response spectrum), one column per mode.
+    FloatMatrix modalValues;
+    /// Number of modes stored so far.
+    int storedModes = 0;
+
+    /// Number of values per station: 6 forces, 6 displacements and 6 winkler reactions.
+    static const int StationSize = 18;
+    /// Number of stations per beam, at the beam ends and at quarters of the length.
+    static const int StationsPerBeam = 5;
+    /// Element numbers of beams in the result store.
+    IntArray beamNumbers;
+    /// Index of beam in the result store (one based) for each element number, zero for other elements.
+    IntArray beamIndices;
+    /// Stations of i-th beam are beamOffsets(i) ... beamOffsets(i+1)-1 (zero based).
+    IntArray beamOffsets;
+    /// Distances of stations from the beam start.
+    FloatArray stationPositions;
+    /// Results of current step, StationSize values per station for all stations of all beams.
+    FloatArray results;
 
 #ifdef MEMSTR
 	bool usestream = true;
@@ -93,23 +119,12 @@ public:
     static int checkValidType(const char* name) { return (strcmp(name, "Beam3d") == 0) || (strcmp(name, "Beam2d") == 0) || (strcmp(name, "beam3d") == 0) || (strcmp(name, "beam2d") == 0); };
 
 private:
-    
-    std::map< int, std::map< double, FloatArray > >BeamForces;
-    std::map< int, std::map< double, FloatArray > >BeamDisplacements;
-    std::map< int, std::map< double, FloatArray > >BeamWinkler;
-
-    std::list<std::map< int, std::map< double, FloatArray > > >BeamForcesList;
-    std::list<std::map< int, std::map< double, FloatArray > > >BeamDisplacementsList;
-    std::list<std::map< int, std::map< double, FloatArray > > >BeamWinklerList;
-
-    std::map< int, std::map< double, FloatArray > >combBeamForces;
-    std::map< int, std::map< double, FloatArray > >combBeamDisplacements;
-    std::map< int, std::map< double, FloatArray > >combBeamWinkler;
-
-    virtual void populateElResults(std::map<int, std::map<double, FloatArray>> &answer, std::map<int, std::map<double, FloatArray>> &src);
-    virtual void addMultiply(std::map<int, std::map<double, FloatArray>> &answer, std::map<int, std::map<double, FloatArray>> &src, std::map<int, std::map<double, FloatArray>> &src2, double fact = 1.0);
-    virtual void calcRoot(std::map<int, std::map<double, FloatArray>> &answer);
-    void correctSigns(std::map<int, std::map<double, FloatArray>> &answer, std::map<int, std::map<double, FloatArray>> &src, bool use1stmode = true);
+    /// Sets up the layout of the result store for the beams of given domain and clears the stored values.
+    void initializeStore( Domain *d );
+    /// Returns the values of given station (zero based) of i-th beam in the result store.
+    double *giveStationValues( int beam, int station ) { return results.givePointer() + ( beamOffsets.at( beam ) + station ) * StationSize; }
+    /// Sets the signs of combined displacements and winkler reactions according to given mode.
+    void correctSigns(int mode);
     virtual void SRSS();
     virtual void CQC();
 
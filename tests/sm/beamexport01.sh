@@ -0,0 +1,50 @@
+#
+# this test checks the beam diagram values exported by BeamExportModule (bem) at the stations of a cantilever,
+# for two load cases and for their combination superposed from stored station values
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f beamexport01.in.0"
+$OOFEM -f beamexport01.in.0 || exit 1
+
+# step, beam, distance from I end, N_x, T_y, T_z, M_x, M_y, M_z, dx, dy, dz, rx, ry, rz, q_winky, q_winkz
+cat > beamexport01.ref <<END
+1 1 0.00000e+00 -3.00000e+00 0.00000e+00 -1.00000e+00 0.00000e+00 4.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00
+1 1 1.00000e+00 -3.00000e+00 0.00000e+00 -1.00000e+00 0.00000e+00 3.00000e+00 0.00000e+00 -3.00000e-04 0.00000e+00 -1.83333e-02 0.00000e+00 3.50000e-02 0.00000e+00 0.00000e+00 0.00000e+00
+1 1 2.00000e+00 -3.00000e+00 0.00000e+00 -1.00000e+00 0.00000e+00 2.00000e+00 0.00000e+00 -6.00000e-04 0.00000e+00 -6.66667e-02 0.00000e+00 6.00000e-02 0.00000e+00 0.00000e+00 0.00000e+00
+1 1 3.00000e+00 -3.00000e+00 0.00000e+00 -1.00000e+00 0.00000e+00 1.00000e+00 0.00000e+00 -9.00000e-04 0.00000e+00 -1.35000e-01 0.00000e+00 7.50000e-02 0.00000e+00 0.00000e+00 0.00000e+00
+1 1 4.00000e+00 -3.00000e+00 0.00000e+00 -1.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 -1.20000e-03 0.00000e+00 -2.13333e-01 0.00000e+00 8.00000e-02 0.00000e+00 0.00000e+00 0.00000e+00
+2 1 0.00000e+00 0.00000e+00 5.00000e-01 0.00000e+00 0.00000e+00 0.00000e+00 2.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00
+2 1 1.00000e+00 0.00000e+00 5.00000e-01 0.00000e+00 0.00000e+00 0.00000e+00 1.50000e+00 0.00000e+00 9.16667e-03 0.00000e+00 0.00000e+00 0.00000e+00 1.75000e-02 0.00000e+00 0.00000e+00
+2 1 2.00000e+00 0.00000e+00 5.00000e-01 0.00000e+00 0.00000e+00 0.00000e+00 1.00000e+00 0.00000e+00 3.33333e-02 0.00000e+00 0.00000e+00 0.00000e+00 3.00000e-02 0.00000e+00 0.00000e+00
+2 1 3.00000e+00 0.00000e+00 5.00000e-01 0.00000e+00 0.00000e+00 0.00000e+00 5.00000e-01 0.00000e+00 6.75000e-02 0.00000e+00 0.00000e+00 0.00000e+00 3.75000e-02 0.00000e+00 0.00000e+00
+2 1 4.00000e+00 0.00000e+00 5.00000e-01 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 1.06667e-01 0.00000e+00 0.00000e+00 0.00000e+00 4.00000e-02 0.00000e+00 0.00000e+00
+3 1 0.00000e+00 -3.00000e+00 7.50000e-01 -1.00000e+00 0.00000e+00 4.00000e+00 3.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00
+3 1 1.00000e+00 -3.00000e+00 7.50000e-01 -1.00000e+00 0.00000e+00 3.00000e+00 2.25000e+00 -3.00000e-04 1.37500e-02 -1.83333e-02 0.00000e+00 3.50000e-02 2.62500e-02 0.00000e+00 0.00000e+00
+3 1 2.00000e+00 -3.00000e+00 7.50000e-01 -1.00000e+00 0.00000e+00 2.00000e+00 1.50000e+00 -6.00000e-04 5.00000e-02 -6.66667e-02 0.00000e+00 6.00000e-02 4.50000e-02 0.00000e+00 0.00000e+00
+3 1 3.00000e+00 -3.00000e+00 7.50000e-01 -1.00000e+00 0.00000e+00 1.00000e+00 7.50000e-01 -9.00000e-04 1.01250e-01 -1.35000e-01 0.00000e+00 7.50000e-02 5.62500e-02 0.00000e+00 0.00000e+00
+3 1 4.00000e+00 -3.00000e+00 7.50000e-01 -1.00000e+00 0.00000e+00 0.00000e+00 0.00000e+00 -1.20000e-03 1.60000e-01 -2.13333e-01 0.00000e+00 8.00000e-02 6.00000e-02 0.00000e+00 0.00000e+00
+END
+
+# compare all station lines with the reference, except for the time column
+grep -v '^#' beamexport01.out.bem | awk -F';' '
+    NR == FNR { for ( i = 1; i <= NF; i++ ) ref[FNR, i] = $i; nref = FNR; next }
+    {
+        n++
+        split($0, val, ";")
+        if ( val[2] != ref[n, 2] ) { print "line " n ": beam " val[2] ", expected " ref[n, 2]; err = 1 }
+        for ( i = 3; i <= 17; i++ ) {
+            d = val[i] - ref[n, i]
+            if ( d < 0 ) d = -d
+            if ( d > 1.e-5 + 1.e-4 * ( ref[n, i] < 0 ? -ref[n, i] : ref[n, i] ) ) {
+                print "line " n ", column " i ": value " val[i] ", expected " ref[n, i]; err = 1
+            }
+        }
+    }
+    END {
+        if ( n != nref ) { print n " station lines found, expected " nref; err = 1 }
+        exit err
+    }' FS=' ' beamexport01.ref FS=';' - || exit 1
+rm -f beamexport01.ref
@@ -0,0 +1,13 @@
+#
+# this test checks conversion of input file to binary fast-load format
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f bininput01.in.0 -tobin bininput01.bin"
+# convert text input to binary input
+$OOFEM -f bininput01.in.0 -tobin bininput01.bin || exit 1
+echo "Command: $OOFEM -f bininput01.bin"
+# run analysis from binary input (checks are read from the text input)
+$OOFEM -f bininput01.bin
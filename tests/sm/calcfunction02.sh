@@ -0,0 +1,20 @@
+#
+# this test checks that malformed CalculatorFunction expressions are rejected with an input error
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+for expr in '2*(t+1' '2*)' 'sqrt4' '2$t'; do
+    sed "s/^UsrDefLTF 1 f(t) .*/UsrDefLTF 1 f(t) $expr/" calcfunction01.in > calcfunction02.in.tmp
+    echo "Command: $OOFEM -f calcfunction02.in.tmp (f(t) $expr)"
+    if $OOFEM -f calcfunction02.in.tmp > calcfunction02.log 2>&1; then
+        echo "malformed expression $expr accepted"
+        exit 1
+    fi
+    if ! grep -q "malformed expression" calcfunction02.log; then
+        cat calcfunction02.log
+        exit 1
+    fi
+done
+rm -f calcfunction02.in.tmp calcfunction02.log
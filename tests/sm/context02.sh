@@ -0,0 +1,15 @@
+#
+# this test checks save/restore of sectioned, compressed and asynchronously written context files
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+for case in context02.in.0 context03.in.0 context04.in.0; do
+    echo "Command: $OOFEM -f $case -c"
+    # run target on input and store context file
+    $OOFEM -f $case -c || exit 1
+    echo "Command: $OOFEM -f $case -r 1"
+    # run target on the same file, but restarting from step 2
+    $OOFEM -f $case -r 1 || exit 1
+done
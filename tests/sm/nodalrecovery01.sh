@@ -0,0 +1,35 @@
+#
+# this test checks that nodal averaging of several internal variables in one pass (parallel over the elements
+# of the region) gives the same nodal values as recovering each variable on its own
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f nodalrecovery01.in.0"
+$OOFEM -f nodalrecovery01.in.0 || exit 1
+
+# same problem, one export module (and thus one recovery) per variable
+sed -e '1s/.*/nodalrecovery01s.out/' \
+    -e 's/ nmodules 1$/ nmodules 3/' \
+    -e 's/^vtkxml .*/vtkxml tstep_all domain_all vars 1 1\nvtkxml tstep_all domain_all vars 1 81\nvtkxml tstep_all domain_all vars 1 4/' \
+    nodalrecovery01.in.0 > nodalrecovery01s.in.tmp
+echo "Command: $OOFEM -f nodalrecovery01s.in.tmp"
+$OOFEM -f nodalrecovery01s.in.tmp || exit 1
+
+# prints the values of the named point data array
+extract() {
+    awk -v name="Name=\"$1\"" 'BEGIN { RS = "</DataArray>" } index($0, name) { sub(/.*format="ascii">/, ""); print }' $2
+}
+
+m=1
+for var in IST_StressTensor IST_vonMisesStress IST_StrainTensor; do
+    extract $var nodalrecovery01.out.m1.1.vtu > nodalrecovery01.all.tmp
+    extract $var nodalrecovery01s.out.m$m.1.vtu > nodalrecovery01.one.tmp
+    if [ ! -s nodalrecovery01.all.tmp ] || ! cmp -s nodalrecovery01.all.tmp nodalrecovery01.one.tmp; then
+        echo "recovered $var differs from its separate recovery"
+        exit 1
+    fi
+    m=$((m + 1))
+done
+rm -f nodalrecovery01s.in.tmp nodalrecovery01.all.tmp nodalrecovery01.one.tmp
@@ -0,0 +1,27 @@
+#
+# this test checks that fill reducing orderings are applied and reduce the predicted factor size
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+for test in "ordering01.in:nested dissection" "ordering02.in:approximate minimum degree" "ordering03.in:approximate minimum degree"; do
+    input=${test%%:*}
+    ordering=${test#*:}
+    echo "Command: $OOFEM -f $input"
+    $OOFEM -f $input > ordering04.log 2>&1 || { cat ordering04.log; exit 1; }
+    if ! grep -q "Renumbering DOFs with $ordering ordering" ordering04.log; then
+        echo "$input: $ordering ordering not used"
+        exit 1
+    fi
+    # "Predicted factor nnz N, flops F (natural ordering N0, F0)"
+    line=$(grep "Predicted factor nnz" ordering04.log)
+    echo "$line"
+    nnz=$(echo "$line" | sed 's/.*nnz \([0-9]*\),.*/\1/')
+    natural=$(echo "$line" | sed 's/.*natural ordering \([0-9]*\),.*/\1/')
+    if [ -z "$nnz" ] || [ -z "$natural" ] || [ "$nnz" -ge "$natural" ]; then
+        echo "$input: factor nnz $nnz not reduced (natural ordering $natural)"
+        exit 1
+    fi
+done
+rm -f ordering04.log
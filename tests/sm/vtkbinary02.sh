@@ -0,0 +1,80 @@
+#
+# this test decodes the appended data of raw, base64 and zlib compressed vtu files
+# and compares the arrays with the ascii vtu file of the same step
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+if ! command -v python3 > /dev/null; then
+    echo "python3 not found, test skipped"
+    exit 0
+fi
+
+echo "Command: $OOFEM -f vtkbinary02.in.0"
+$OOFEM -f vtkbinary02.in.0 || exit 1
+
+python3 - vtkbinary02.out.m1.1.vtu vtkbinary02.out.m2.1.vtu vtkbinary02.out.m3.1.vtu vtkbinary02.out.m4.1.vtu vtkbinary02.out.m5.1.vtu <<'END'
+import base64, re, struct, sys, zlib
+
+formats = { 'Float64': 'd', 'Int32': 'i', 'UInt8': 'B' }
+attribute = re.compile(rb'(\w+)="([^"]*)"')
+
+def arrays(name):
+    """Returns (type, name, values) of all DataArray elements of vtu file."""
+    data = open(name, 'rb').read()
+    xml, _, appended = data.partition(b'<AppendedData')
+    header = dict(attribute.findall(xml[:xml.index(b'>', xml.index(b'<VTKFile'))]))
+    if appended:
+        encoding = dict(attribute.findall(appended[:appended.index(b'>')]))[b'encoding']
+        appended = appended[appended.index(b'_') + 1:]
+    order = '<' if header.get(b'byte_order', b'LittleEndian') == b'LittleEndian' else '>'
+    compressed = b'compressor' in header
+    answer = []
+    for element in re.finditer(rb'<DataArray([^>]*?)(/>|>(.*?)</DataArray>)', xml, re.S):
+        attrs = dict(attribute.findall(element.group(1)))
+        kind = attrs[b'type'].decode()
+        if attrs[b'format'] == b'ascii':
+            values = [float(v) for v in element.group(3).split()]
+        else:
+            values = decode(appended[int(attrs[b'offset']):], encoding, compressed, order)
+            values = list(struct.unpack(order + str(len(values) // struct.calcsize(formats[kind])) + formats[kind], values))
+        answer.append((kind, attrs.get(b'Name'), values))
+    return answer
+
+def decode(block, encoding, compressed, order):
+    """Decodes the block of one array starting at the beginning of given data."""
+    def peek():
+        first = block[:8] if encoding == b'raw' else base64.b64decode(block[:12])[:8]
+        return struct.unpack(order + 'Q', first)[0]
+    def take(nbytes):
+        nonlocal block
+        nchars = nbytes if encoding == b'raw' else (nbytes + 2) // 3 * 4
+        chunk, block = block[:nchars], block[nchars:]
+        return chunk if encoding == b'raw' else base64.b64decode(chunk)
+    if not compressed:
+        # header and data are encoded together
+        return take(8 + peek())[8:]
+    # compression header is encoded separately from the blocks
+    nblocks = peek()
+    sizes = struct.unpack(order + str(3 + nblocks) + 'Q', take(8 * (3 + nblocks)))[3:]
+    data = take(sum(sizes))
+    answer = b''
+    for size in sizes:
+        answer += zlib.decompress(data[:size])
+        data = data[size:]
+    return answer
+
+reference = arrays(sys.argv[1])
+for name in sys.argv[2:]:
+    decoded = arrays(name)
+    if [a[:2] for a in decoded] != [a[:2] for a in reference]:
+        sys.exit('%s: data arrays differ from ascii file' % name)
+    for (kind, array, values), (_, _, expected) in zip(decoded, reference):
+        if len(values) != len(expected):
+            sys.exit('%s: %s has %d values instead of %d' % (name, array, len(values), len(expected)))
+        for v, e in zip(values, expected):
+            if abs(v - e) > 1.e-5 * abs(e) + 1.e-10:
+                sys.exit('%s: %s value %g differs from %g' % (name, array, v, e))
+    print('%s: %d arrays match' % (name, len(decoded)))
+END